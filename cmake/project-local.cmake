@@ -13,6 +13,7 @@ set(FORDYCA_WITH_ROBOT_RAB "NO" CACHE STRING "Enable robots to read/write over t
 set(FORDYCA_WITH_ROBOT_BATTERY "NO" CACHE STRING "Enable robots to use the battery.")
 set(FORDYCA_WITH_ROBOT_LEDS "NO" CACHE STRING "Enable robots to use their LEDs.")
 set(FORDYCA_WITH_ROBOT_CAMERA "YES" CACHE STRING "Enable robots to use their camera.")
+set(FORDYCA_CACHES_ER_LVL "TRACE" CACHE STRING "Maximum verbosity of cache creation diagnostics to compile in [NONE,INFO,DEBUG,TRACE].")
 
 set(fordyca_CHECK_LANGUAGE "CXX")
 
@@ -219,6 +220,10 @@ if (FORDYCA_WITH_ROBOT_LEDS)
     FORDYCA_WITH_ROBOT_LEDS)
 endif()
 
+target_compile_definitions(${fordyca_LIBRARY}
+  PRIVATE
+  FORDYCA_CACHES_ER_LVL=FORDYCA_CACHES_ER_LVL_${FORDYCA_CACHES_ER_LVL})
+
 if ("${COSM_BUILD_FOR}" MATCHES "MSI")
   target_compile_options(${fordyca_LIBRARY} PUBLIC
     -Wno-missing-include-dirs
@@ -23,6 +23,8 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include <atomic>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -40,7 +42,10 @@
 #include "fordyca/fordyca.hpp"
 #include "fordyca/argos/support/tv/tv_manager.hpp"
 #include "fordyca/argos/support/config/argos_swarm_manager_repository.hpp"
+#include "fordyca/argos/support/config/interaction_phase_config.hpp"
+#include "fordyca/argos/support/config/perception_phase_config.hpp"
 #include "fordyca/argos/support/tv/config/tv_manager_config.hpp"
+#include "fordyca/controller/controller_fwd.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -136,6 +141,47 @@ class argos_swarm_manager : public cpargos::swarm_manager_adaptor,
   void delay_arena_map_init(bool b) { m_delay_arena_map_init = b; }
   bool delay_arena_map_init(void) const { return m_delay_arena_map_init; }
 
+  /**
+   * \brief If enabled, update the perception of a robot with a cognitive
+   * controller from the loop functions, so that its control step only
+   * consumes the updated model. Must be called by derived classes after the
+   * robot has been sent its LOS for the timestep, from within the same
+   * callback, because we are only allowed 1 usage of ARGoS threads per
+   * PreStep().
+   */
+  void robot_perception_update(controller::foraging_controller* controller);
+
+  /**
+   * \brief Process all robots after their controllers have been run: have each
+   * one interact with the arena via \p interact, and then collect metrics from
+   * it via \p collect.
+   *
+   * By default, this is done robot by robot, spread across all ARGoS
+   * threads. If interactions are serial, all robots interact with the arena
+   * first in a single pass in a fixed robot order, so the arena locks are
+   * uncontended and the outcome of conflicting interactions (e.g., two robots
+   * picking up the last block in a cache) does not depend on the # of threads
+   * or how they are scheduled; metrics are then collected from all robots
+   * across all ARGoS threads.
+   */
+  void robots_post_step(
+      const std::function<void(controller::foraging_controller*)>& interact,
+      const std::function<void(controller::foraging_controller*)>& collect);
+
+  /**
+   * \brief Mark the oracle as out of date because a robot interaction changed
+   * the set of blocks/caches in the arena. Thread safe, so it can be called
+   * while processing robots in parallel.
+   */
+  void oracle_invalidate(void) { m_oracle_stale = true; }
+
+  /**
+   * \brief Bring the oracle up to date with the arena if anything has
+   * invalidated it since it was last updated. Must be called outside of
+   * parallel robot processing.
+   */
+  void oracle_refresh(void);
+
  private:
   /**
    * \brief Initialize convergence calculations.
@@ -166,8 +212,27 @@ class argos_swarm_manager : public cpargos::swarm_manager_adaptor,
    */
   void oracle_init(const coconfig::aggregate_oracle_config* oraclep) RCPPSW_COLD;
 
+  /**
+   * \brief Initialize updating robot perception in the loop functions.
+   *
+   * \param config Parsed perception phase parameters.
+   */
+  void perception_phase_init(
+      const fasupport::config::perception_phase_config* config) RCPPSW_COLD;
+
+  /**
+   * \brief Initialize how robot interactions with the arena are processed.
+   *
+   * \param config Parsed interaction phase parameters.
+   */
+  void interaction_phase_init(
+      const fasupport::config::interaction_phase_config* config) RCPPSW_COLD;
+
   /* clang-format off */
   bool                                              m_delay_arena_map_init{false};
+  bool                                              m_perception_phase{false};
+  bool                                              m_interactions_serial{false};
+  std::atomic_bool                                  m_oracle_stale{true};
   fasupport::config::argos_swarm_manager_repository m_config{};
   std::unique_ptr<fastv::tv_manager>                m_tv_manager;
   std::unique_ptr<convergence_calculator_type>      m_conv_calc;
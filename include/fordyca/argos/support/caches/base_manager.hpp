@@ -24,6 +24,7 @@
  * Includes
  ******************************************************************************/
 #include <mutex>
+#include <unordered_map>
 #include <vector>
 #include <boost/optional.hpp>
 
@@ -40,6 +41,7 @@
 #include "fordyca/fordyca.hpp"
 #include "fordyca/metrics/caches/lifecycle_metrics.hpp"
 #include "fordyca/argos/support/caches/config/caches_config.hpp"
+#include "fordyca/argos/support/caches/cache_index.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -67,7 +69,8 @@ class base_manager : public fmetrics::caches::lifecycle_metrics,
                carena::caching_arena_map* const map)
       : ER_CLIENT_INIT("fordyca.argos.support.cache_manager"),
         mc_config(*config),
-        m_map(map) {}
+        m_map(map),
+        m_index(config->dimension) {}
   ~base_manager(void) override = default;
 
   base_manager(const base_manager&) = delete;
@@ -95,15 +98,34 @@ class base_manager : public fmetrics::caches::lifecycle_metrics,
   }
   std::mutex& mtx(void) { return m_mutex; }
 
+  /**
+   * \brief The index over the caches currently in the arena. Must be updated
+   * via \ref caches_index_update() whenever caches are created or depleted.
+   */
+  const cache_index* caches_index(void) const { return &m_index; }
+  void caches_index_update(const cads::acache_vectorno& caches) {
+    m_index.update(caches);
+  }
+
  protected:
   struct creation_blocks {
     cds::block3D_vectorno usable{};
     cds::block3D_htno absorbable{};
   };
+
+  /**
+   * \brief The existing cache/block cluster (if any) each block is a member
+   * of, by ID. Built once per creation pass so that block allocation filters
+   * do not have to search all caches/clusters for each block.
+   */
+  struct block_membership {
+    std::unordered_map<int, int> cache{};
+    std::unordered_map<int, int> cluster{};
+  };
+
   using block_alloc_filter_type = std::function<bool(
       const crepr::sim_block3D* block,
-      const cads::acache_vectorno& existing_caches,
-      const cfds::block3D_cluster_vectorro& clusters)>;
+      const block_membership& membership)>;
 
   boost::optional<creation_blocks> creation_blocks_alloc(
       const cds::block3D_vectorno& all_blocks,
@@ -112,6 +134,14 @@ class base_manager : public fmetrics::caches::lifecycle_metrics,
       const block_alloc_filter_type& usable_filter,
       const block_alloc_filter_type& absorbable_filter);
 
+  /**
+   * \brief Compute the cache/block cluster membership of all blocks which are
+   * in a cache or a cluster.
+   */
+  block_membership block_membership_calc(
+      const cads::acache_vectorno& existing_caches,
+      const cfds::block3D_cluster_vectorro& clusters) const;
+
   bool creation_blocks_alloc_check(const creation_blocks& c_allocated,
                                    const cads::acache_vectorno& c_existing_caches) const;
 
@@ -162,6 +192,7 @@ class base_manager : public fmetrics::caches::lifecycle_metrics,
   std::vector<rtypes::timestep>          m_depletion_ages{};
 
   carena::caching_arena_map * const      m_map;
+  cache_index                            m_index;
   std::mutex                             m_mutex{};
   /* clang-format on */
 };
@@ -0,0 +1,107 @@
+/**
+ * \file cache_index.hpp
+ *
+ * \copyright 2022 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+#pragma once
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#include "rcppsw/math/vector2.hpp"
+#include "rcppsw/types/spatial_dist.hpp"
+#include "rcppsw/types/type_uuid.hpp"
+
+#include "cosm/arena/ds/cache_vector.hpp"
+
+#include "fordyca/ds/spatial_hash.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(fordyca, argos, support, caches);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class cache_index
+ * \ingroup argos support caches
+ *
+ * \brief Index over the caches in the arena: by ID, and by location for radius
+ * queries, so that robot-cache interactions do not need to scan all caches in
+ * the arena.
+ *
+ * The index does not track the arena map itself; it must be updated via \ref
+ * update() whenever caches are added to/removed from the arena, and is subject
+ * to the same locking requirements as the arena map caches.
+ *
+ * The index also holds a mutex for each cache, for operations which only
+ * modify a single cache (e.g. block pickup/drop) to lock instead of the arena
+ * cache mutex as a writer. Such operations must still hold the arena cache
+ * mutex as a reader so that caches cannot be created/depleted concurrently
+ * (which requires the arena cache mutex as a writer).
+ */
+class cache_index {
+ public:
+  explicit cache_index(const rtypes::spatial_dist& bucket_dim)
+      : m_spatial(bucket_dim) {}
+
+  /* Not copy constructable/assignable by default */
+  cache_index(const cache_index&) = delete;
+  cache_index& operator=(const cache_index&) = delete;
+
+  /**
+   * \brief Rebuild the index from the current set of caches in the arena.
+   */
+  void update(const cads::acache_vectorno& caches);
+
+  /**
+   * \brief Get the cache with the specified ID, or NULL if there is no such
+   * cache.
+   */
+  carepr::arena_cache* find(const rtypes::type_uuid& id) const;
+
+  /**
+   * \brief Get the first cache (in arena order) whose center is within \p
+   * dist of \p pos, or NULL if there is no such cache.
+   */
+  carepr::arena_cache* within(const rmath::vector2d& pos,
+                              const rtypes::spatial_dist& dist) const;
+
+  /**
+   * \brief Get the mutex for the cache with the specified ID, or NULL if there
+   * is no such cache.
+   */
+  std::mutex* mtx(const rtypes::type_uuid& id) const;
+
+  size_t size(void) const { return m_by_id.size(); }
+
+ private:
+  /* clang-format off */
+  std::unordered_map<int, carepr::arena_cache*>                m_by_id{};
+  std::unordered_map<int, std::unique_ptr<std::mutex>>         m_mtxs{};
+  fds::spatial_hash<std::pair<size_t, carepr::arena_cache*>>   m_spatial;
+  /* clang-format on */
+};
+
+NS_END(caches, support, argos, fordyca);
@@ -132,9 +132,59 @@ class cached_block_pickup_interactor : public rer::client<
      *
      * Grid mutex is also required, but only within the actual \ref
      * cached_block_pickup event visit to the arena map.
+     *
+     * Most pickups only modify the cache being picked up from, so only that
+     * cache's mutex is needed (plus the arena cache mutex as a reader, so that
+     * caches cannot be created/depleted concurrently), and pickups from
+     * different caches can proceed in parallel. A pickup which will deplete the
+     * cache changes the set of caches in the arena, and so is done holding the
+     * arena cache and block mutexes as a writer, as is handling a cache which
+     * has vanished.
      */
-    m_map->lock_wr(m_map->cache_mtx());
-    m_map->lock_wr(m_map->block_mtx());
+    bool exclusive = true;
+    m_map->lock_rd(m_map->cache_mtx());
+    if (auto* mtx = m_cache_manager->caches_index()->mtx(p.id())) {
+      std::scoped_lock lock(*mtx);
+      const auto* cache = m_cache_manager->caches_index()->find(p.id());
+      if (cache->n_blocks() > carepr::base_cache::kMinBlocks) {
+        exclusive = false;
+        status = pickup_checked(controller, p, t, carena::locking::ekCACHES_HELD);
+        ER_ASSERT(fsupport::interactor_status::ekCACHE_DEPLETION != status,
+                  "Cache%d depleted without exclusive access",
+                  p.id().v());
+      }
+    }
+    m_map->unlock_rd(m_map->cache_mtx());
+
+    if (exclusive) {
+      m_map->lock_wr(m_map->cache_mtx());
+      m_map->lock_wr(m_map->block_mtx());
+      status = pickup_checked(controller,
+                              p,
+                              t,
+                              carena::locking::ekCACHES_HELD |
+                                  carena::locking::ekBLOCKS_HELD);
+      m_map->unlock_wr(m_map->block_mtx());
+      m_map->unlock_wr(m_map->cache_mtx());
+    }
+
+    m_penalty_handler->penalty_remove(p);
+
+    return status;
+  }
+
+  /**
+   * \brief Check that the cache the robot is picking up from still exists and
+   * that picking up from it does not violate the robot's pickup policy, and if
+   * so perform the pickup.
+   *
+   * \param locking The arena map locks held by the caller.
+   */
+  fsupport::interactor_status pickup_checked(TController& controller,
+                                             const ctv::temporal_penalty& p,
+                                             const rtypes::timestep& t,
+                                             const carena::locking& locking) {
+    auto status = fsupport::interactor_status::ekNO_EVENT;
 
     /*
      * If two collector robots enter a cache that only contains 2 blocks on the
@@ -158,9 +208,6 @@ class cached_block_pickup_interactor : public rer::client<
       ER_WARN("%s cannot pickup from from cache%d: No such cache",
               controller.GetId().c_str(),
               p.id().v());
-      m_map->unlock_wr(m_map->block_mtx());
-      m_map->unlock_wr(m_map->cache_mtx());
-
       robot_cache_vanished_visitor_type vanished_op(p.id());
       vanished_op.visit(controller);
     } else {
@@ -181,7 +228,7 @@ class cached_block_pickup_interactor : public rer::client<
        * cache's status will be picked up by the second robot next timestep.
        */
       if (v(controller.rpos2D(), p.id(), t)) {
-        status = execute_cached_block_pickup(controller, p, t);
+        status = execute_cached_block_pickup(controller, p, t, locking);
         if (status == fsupport::interactor_status::ekCACHE_DEPLETION) {
           m_floor->SetChanged();
         }
@@ -190,12 +237,7 @@ class cached_block_pickup_interactor : public rer::client<
                 controller.GetId().c_str(),
                 p.id().v());
       }
-      m_map->unlock_wr(m_map->block_mtx());
-      m_map->unlock_wr(m_map->cache_mtx());
     }
-
-    m_penalty_handler->penalty_remove(p);
-
     return status;
   }
 
@@ -215,12 +257,10 @@ class cached_block_pickup_interactor : public rer::client<
   fsupport::interactor_status
   execute_cached_block_pickup(TController& controller,
                               const ctv::temporal_penalty& penalty,
-                              const rtypes::timestep& t) {
-    auto real_it =
-        std::find_if(m_map->caches().begin(),
-                     m_map->caches().end(),
-                     [&](const auto& c) { return c->id() == penalty.id(); });
-    ER_ASSERT(real_it != m_map->caches().end(),
+                              const rtypes::timestep& t,
+                              const carena::locking& locking) {
+    auto* real = m_cache_manager->caches_index()->find(penalty.id());
+    ER_ASSERT(nullptr != real,
               "Cache%d from penalty does not exist?",
               penalty.id().v());
 
@@ -230,18 +270,23 @@ class cached_block_pickup_interactor : public rer::client<
      * map, the reference to the block the robot picked up is still valid,
      * because it points to somewhere within the the block vector owned by the
      * arena map.
+     *
+     * The block is selected using the robot's RNG rather than the loop
+     * function's, because pickups from different caches can happen
+     * concurrently, and the robot's RNG is only ever used by the thread
+     * processing it.
      */
-    auto* to_pickup = (*real_it)->block_select(m_loop->rng());
+    auto* to_pickup = real->block_select(controller.rng());
 
     caops::cached_block_pickup_visitor arena_pickup(
-        *real_it,
+        real,
         to_pickup,
         m_loop,
         controller.entity_id(),
         t,
-        carena::locking::ekCACHES_HELD | carena::locking::ekBLOCKS_HELD);
+        locking);
 
-    (*real_it)->penalty_served(penalty.penalty());
+    real->penalty_served(penalty.penalty());
     controller.block_manip_recorder()->record(
         fmetrics::blocks::block_manip_events::ekCACHE_PICKUP, penalty.penalty());
 
@@ -257,6 +302,9 @@ class cached_block_pickup_interactor : public rer::client<
      * exactly this purpose.
      */
     if (m_map->caches().size() < old_n_caches) {
+      /* still holding the cache mutex, so safe to update the index */
+      m_cache_manager->caches_index_update(m_map->caches());
+
       auto zombie_it =
           std::find_if(m_map->zombie_caches().begin(),
                        m_map->zombie_caches().end(),
@@ -280,7 +328,7 @@ class cached_block_pickup_interactor : public rer::client<
       return fsupport::interactor_status::ekCACHE_DEPLETION;
     } else {
       robot_cached_block_pickup_visitor_type robot_real_pickup(
-          *real_it, to_pickup, controller.entity_id(), t);
+          real, to_pickup, controller.entity_id(), t);
 
       /* 2nd, visit the controller (normal case) */
       robot_real_pickup.visit(controller);
@@ -0,0 +1,88 @@
+/**
+ * \file caches_er.hpp
+ *
+ * \copyright 2022 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#pragma once
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "rcppsw/er/client.hpp"
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/**
+ * \brief Verbosity levels for cache subsystem diagnostics (cache creation,
+ * allocation, verification), which can be capped at compile time by defining
+ * FORDYCA_CACHES_ER_LVL to one of them.
+ */
+#define FORDYCA_CACHES_ER_LVL_NONE 0
+#define FORDYCA_CACHES_ER_LVL_INFO 1
+#define FORDYCA_CACHES_ER_LVL_DEBUG 2
+#define FORDYCA_CACHES_ER_LVL_TRACE 3
+
+#ifndef FORDYCA_CACHES_ER_LVL
+#define FORDYCA_CACHES_ER_LVL FORDYCA_CACHES_ER_LVL_TRACE
+#endif
+
+/**
+ * \brief Will a message at the specified level from the calling \ref
+ * rer::client actually be logged? \c FALSE at compile time if event reporting
+ * is disabled or the level is above the cap, so that anything guarded by it is
+ * compiled out.
+ */
+#if (LIBRA_ER == LIBRA_ER_ALL)
+#define CACHES_ER_ENABLED(lvl, check)                                   \
+  (FORDYCA_CACHES_ER_LVL >= FORDYCA_CACHES_ER_LVL_##lvl &&              \
+   this->logger()->check())
+#else
+#define CACHES_ER_ENABLED(lvl, check) false
+#endif
+
+#define CACHES_ER_INFO_ENABLED() CACHES_ER_ENABLED(INFO, isInfoEnabled)
+#define CACHES_ER_DEBUG_ENABLED() CACHES_ER_ENABLED(DEBUG, isDebugEnabled)
+#define CACHES_ER_TRACE_ENABLED() CACHES_ER_ENABLED(TRACE, isTraceEnabled)
+
+/**
+ * \brief Same as ER_INFO()/ER_DEBUG()/ER_TRACE(), except that the message
+ * arguments (which in the cache subsystem are often entire vectors of
+ * blocks/caches formatted as strings) are only evaluated if the message will
+ * actually be logged.
+ */
+#define CACHES_ER_INFO(...)                     \
+  do {                                          \
+    if (CACHES_ER_INFO_ENABLED()) {             \
+      ER_INFO(__VA_ARGS__);                     \
+    }                                           \
+  } while (0)
+
+#define CACHES_ER_DEBUG(...)                    \
+  do {                                          \
+    if (CACHES_ER_DEBUG_ENABLED()) {            \
+      ER_DEBUG(__VA_ARGS__);                    \
+    }                                           \
+  } while (0)
+
+#define CACHES_ER_TRACE(...)                    \
+  do {                                          \
+    if (CACHES_ER_TRACE_ENABLED()) {            \
+      ER_TRACE(__VA_ARGS__);                    \
+    }                                           \
+  } while (0)
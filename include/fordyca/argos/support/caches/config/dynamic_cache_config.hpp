@@ -71,6 +71,21 @@ struct dynamic_cache_config final : public rconfig::base_config {
    * which may not be desirable.
    */
   bool   robot_drop_only{false};
+
+  /**
+   * \brief If \c TRUE, then dynamic cache creation triggered by robot block
+   * drops is planned on a background thread while robot controllers run on the
+   * following timestep, and the planned caches are created at the end of that
+   * timestep, rather than being done immediately.
+   */
+  bool   async{false};
+
+  /**
+   * \brief The full (quadratic) audit of the caches created during a creation
+   * pass is run every this many creation passes, in addition to the
+   * incremental verification of each created cache. 0 disables the audit.
+   */
+  uint   audit_interval{0};
 };
 
 NS_END(config, caches, support, argos, fordyca);
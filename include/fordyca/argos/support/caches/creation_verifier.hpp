@@ -23,6 +23,9 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include <functional>
+#include <unordered_map>
+#include <utility>
 
 #include "rcppsw/er/client.hpp"
 #include "rcppsw/types/spatial_dist.hpp"
@@ -33,6 +36,8 @@
 #include "cosm/arena/ds/cache_vector.hpp"
 #include "cosm/foraging/ds/block_cluster_vector.hpp"
 
+#include "fordyca/ds/spatial_hash.hpp"
+
 /*******************************************************************************
  * Namespaces
  ******************************************************************************/
@@ -53,6 +58,13 @@ NS_START(fordyca, argos, support, caches);
  * \brief Provides verification of newly created caches, indicating to calling
  *        classes if the newly created cache should be kept or discarded
  *        (according to configuration).
+ *
+ * Caches created one at a time are verified incrementally via \ref
+ * verify_single(): only the new cache is checked, against an index of the
+ * caches already verified by this object and of the blocks in the arena, so
+ * creating N caches in a pass is linear in N. The full set of checks on all
+ * verified caches is available via \ref audit(), which is quadratic in N, and
+ * so should only be run periodically.
  */
 class creation_verifier : public rer::client<creation_verifier> {
  public:
@@ -64,12 +76,38 @@ class creation_verifier : public rer::client<creation_verifier> {
   creation_verifier& operator=(const creation_verifier&) = delete;
 
   /**
-   * \brief Is the created cache OK, or should it be discarded?
+   * \brief Is the created cache OK, or should it be discarded? Only the new
+   * cache is checked, against all previously verified caches which were kept.
+   * If the cache should be kept, it is added to the set of verified caches.
+   *
+   * \param cache The newly created cache.
+   * \param c_all_blocks All blocks in the arena. Must be the same for all calls
+   *                     on a given verifier; blocks which are moved between
+   *                     calls must be reported via \ref block_relocated().
+   * \param c_clusters Current block clusters in the arena.
    */
   bool verify_single(const carepr::arena_cache* cache,
-                     const cads::acache_vectorro& c_caches,
                      const cds::block3D_vectorno& c_all_blocks,
-                     const cfds::block3D_cluster_vectorro& c_clusters) const;
+                     const cfds::block3D_cluster_vectorro& c_clusters);
+
+  /**
+   * \brief Update the index of arena blocks after a block has been moved (e.g.,
+   * redistributed after a cache which failed verification was deleted).
+   */
+  void block_relocated(crepr::sim_block3D* block);
+
+  /**
+   * \brief Run the full set of \ref sanity_checks() on all caches which have
+   * been verified (and kept) via \ref verify_single().
+   *
+   * \return The caches which fail the checks, in the order they were
+   * verified; empty if all checks pass. If the checks on the full set fail,
+   * each cache is checked against the (indexed) caches verified before it
+   * which did not fail, so that a cache is only reported if it is the problem.
+   */
+  cads::acache_vectorro audit(
+      const cds::block3D_vectorno& c_all_blocks,
+      const cfds::block3D_cluster_vectorro& c_clusters) const;
 
   /**
    * \brief Basic sanity checks on a set of newly created caches.
@@ -111,11 +149,48 @@ class creation_verifier : public rer::client<creation_verifier> {
   bool sanity_check_nest_overlap(const carepr::arena_cache* cache,
                                  const cads::nest_vectorro& nests) const;
 
+  using cache_filter_type = std::function<bool(const carepr::arena_cache*)>;
+
+  /**
+   * \brief The checks from \ref sanity_checks() for a single cache against the
+   * indexed previously verified caches and arena blocks.
+   *
+   * \param c_owners The cache owning each block in the caches to check
+   *                 against, by block ID.
+   * \param c_against Which of the indexed verified caches to check against.
+   */
+  bool sanity_checks_incremental(
+      const carepr::arena_cache* cache,
+      const cfds::block3D_cluster_vectorro& c_clusters,
+      const std::unordered_map<int, int>& c_owners,
+      const cache_filter_type& c_against) const;
+
+  /**
+   * \brief Blocks which are not carried and not in any verified cache or the
+   * specified cache, and which could overlap the specified cache.
+   */
+  cds::block3D_vectorno free_blocks_near(const carepr::arena_cache* cache) const;
+
+  void index_add(const carepr::arena_cache* cache);
+  void block_index_add(crepr::sim_block3D* block);
+
   /* clang-format off */
-  const rtypes::spatial_dist mc_cache_dim;
-  const bool                 mc_strict_constraints;
+  const rtypes::spatial_dist                    mc_cache_dim;
+  const bool                                    mc_strict_constraints;
 
-  carena::caching_arena_map* m_map;
+  carena::caching_arena_map*                    m_map;
+  cads::acache_vectorro                         m_verified{};
+  std::unordered_map<int, int>                  m_block_owners{};
+  fds::spatial_hash<const carepr::arena_cache*> m_cache_index;
+  fds::spatial_hash<crepr::sim_block3D*>        m_block_index;
+
+  /**
+   * \brief The extent each block was added to \ref m_block_index with, which
+   * is needed to remove it, since blocks can be moved after being indexed
+   * (e.g., into a cache which later fails verification).
+   */
+  std::unordered_map<int, std::pair<rmath::vector2d,
+                                    rmath::vector2d>> m_block_extents{};
   /* clang-format on */
 };
 NS_END(caches, support, argos, fordyca);
@@ -23,6 +23,8 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include <mutex>
+
 #include <argos3/core/simulator/entity/floor_entity.h>
 
 #include "rcppsw/utils/maskable_enum.hpp"
@@ -31,6 +33,7 @@
 #include "cosm/arena/operations/cache_block_drop.hpp"
 
 #include "fordyca/events/existing_cache_interactor.hpp"
+#include "fordyca/argos/support/caches/base_manager.hpp"
 #include "fordyca/argos/support/tv/cache_op_src.hpp"
 #include "fordyca/argos/support/tv/env_dynamics.hpp"
 #include "fordyca/tasks/d1/foraging_task.hpp"
@@ -64,11 +67,13 @@ class existing_cache_block_drop_interactor
       typename controller_spec::robot_cache_block_drop_visitor_type;
 
   existing_cache_block_drop_interactor(carena::caching_arena_map* const map_in,
-                                       fastv::env_dynamics* envd)
+                                       fastv::env_dynamics* envd,
+                                       const fascaches::base_manager* cache_manager)
       : ER_CLIENT_INIT("fordyca.argos.support.caches.existing_cache_block_drop_interactor"),
         m_map(map_in),
         m_penalty_handler(
-            envd->penalty_handler(fastv::cache_op_src::ekEXISTING_CACHE_DROP)) {}
+            envd->penalty_handler(fastv::cache_op_src::ekEXISTING_CACHE_DROP)),
+        mc_cache_manager(cache_manager) {}
 
   existing_cache_block_drop_interactor(existing_cache_block_drop_interactor&&) =
       default;
@@ -115,10 +120,20 @@ class existing_cache_block_drop_interactor
      * cache_vanished event. See FORDYCA#594.
      *
      * Grid and block mutexes are also required, but only within the actual \ref
-     * cached_block_pickup event visit to the arena map.
+     * cached_block_pickup event visit to the arena map, and are taken by the
+     * event itself.
+     *
+     * Dropping a block in a cache only modifies that cache, so only that
+     * cache's mutex is needed (plus the arena cache mutex as a reader, so that
+     * caches cannot be created/depleted concurrently), and drops in different
+     * caches can proceed in parallel. If there is no such cache, we will not
+     * touch any cache below.
      */
-    m_map->lock_wr(m_map->cache_mtx());
-    m_map->lock_rd(m_map->block_mtx());
+    m_map->lock_rd(m_map->cache_mtx());
+    auto* cache_mtx = mc_cache_manager->caches_index()->mtx(penalty.id());
+    if (nullptr != cache_mtx) {
+      cache_mtx->lock();
+    }
 
     /*
      * If two collector robots enter a cache that only contains 2 blocks on the
@@ -148,15 +163,17 @@ class existing_cache_block_drop_interactor
        * We now know we aren't going to update arena state, because the cache
        * associated with the penalty doesn't exist anymore.
        */
-      m_map->unlock_rd(m_map->block_mtx());
-      m_map->unlock_wr(m_map->cache_mtx());
+      if (nullptr != cache_mtx) {
+        cache_mtx->unlock();
+      }
+      m_map->unlock_rd(m_map->cache_mtx());
 
       robot_cache_vanished_visitor_type vanished_op(penalty.id());
       vanished_op.visit(controller);
     } else {
       execute_cache_block_drop(controller, penalty);
-      m_map->unlock_rd(m_map->block_mtx());
-      m_map->unlock_wr(m_map->cache_mtx());
+      cache_mtx->unlock();
+      m_map->unlock_rd(m_map->cache_mtx());
     }
 
     m_penalty_handler->penalty_remove(penalty);
@@ -168,11 +185,8 @@ class existing_cache_block_drop_interactor
    */
   void execute_cache_block_drop(TController& controller,
                                 const ctv::temporal_penalty& penalty) {
-    auto cache_it =
-        std::find_if(m_map->caches().begin(),
-                     m_map->caches().end(),
-                     [&](const auto& c) { return c->id() == penalty.id(); });
-    ER_ASSERT(cache_it != m_map->caches().end(),
+    auto* cache = mc_cache_manager->caches_index()->find(penalty.id());
+    ER_ASSERT(nullptr != cache,
               "Cache%d from penalty does not exist",
               penalty.id().v());
 
@@ -182,19 +196,21 @@ class existing_cache_block_drop_interactor
      * Safe to directly index into arena map block vector without locking
      * because the blocks never move from their original locations.
      *
-     * Need to tell event to perform \ref arena_map block locking because there
-     * we are only holding the cache mutex.
+     * Need to tell event to perform \ref arena_map block locking because
+     * we are only holding the cache mutex. Drops into different caches can
+     * happen concurrently, and the event modifies block state, so it must
+     * hold the block mutex as a writer.
      */
     caops::cache_block_drop_visitor adrop_op(
         m_map->blocks()[block_id.v()],
-        *cache_it,
+        cache,
         m_map->grid_resolution(),
-        carena::locking::ekCACHES_HELD | carena::locking::ekBLOCKS_HELD);
+        carena::locking::ekCACHES_HELD);
     robot_cache_block_drop_visitor_type rdrop_op(controller.block_release(),
-                                                 *cache_it,
+                                                 cache,
                                                  m_map->grid_resolution());
 
-    (*cache_it)->penalty_served(penalty.penalty());
+    cache->penalty_served(penalty.penalty());
     controller.block_manip_recorder()->record(fmblocks::block_manip_events::ekCACHE_DROP,
                                               penalty.penalty());
     /*
@@ -245,8 +261,9 @@ class existing_cache_block_drop_interactor
     return false;
   }
   /* clang-format off */
-  carena::caching_arena_map* const   m_map;
+  carena::caching_arena_map* const      m_map;
   fastv::cache_op_penalty_handler*const m_penalty_handler;
+  const fascaches::base_manager*        mc_cache_manager;
   /* clang-format on */
 };
 
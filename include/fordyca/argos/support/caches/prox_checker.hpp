@@ -27,6 +27,7 @@
 
 #include "cosm/arena/caching_arena_map.hpp"
 
+#include "fordyca/argos/support/caches/cache_index.hpp"
 #include "fordyca/controller/foraging_controller.hpp"
 #include "fordyca/controller/cognitive/d2/events/cache_proximity.hpp"
 
@@ -44,6 +45,9 @@ NS_START(fordyca, argos, support, caches);
  *
  * \brief Check if a controller is too close to a cache for a block drop of some
  * kind.
+ *
+ * If a \ref cache_index is provided, it is used for all cache queries instead
+ * of scanning the arena caches.
  */
 class prox_checker : public rer::client<prox_checker> {
  public:
@@ -54,10 +58,12 @@ class prox_checker : public rer::client<prox_checker> {
   };
 
   prox_checker(const carena::caching_arena_map* const map,
-                     const rtypes::spatial_dist& prox_dist)
+               const rtypes::spatial_dist& prox_dist,
+               const cache_index* const index = nullptr)
       : ER_CLIENT_INIT("fordyca.argos.support.d2.prox_checker"),
         mc_prox_dist(prox_dist),
-        mc_map(map) {}
+        mc_map(map),
+        mc_index(index) {}
 
   /* Not copy constructable/assignable by default */
   prox_checker(const prox_checker&) = delete;
@@ -91,6 +97,19 @@ class prox_checker : public rer::client<prox_checker> {
      * it.
      */
     mc_map->maybe_lock_rd(mc_map->cache_mtx(), need_lock);
+    if (nullptr != mc_index) {
+      ER_ASSERT(mc_index->size() == mc_map->caches().size(),
+                "Cache index out of date: %zu != %zu",
+                mc_index->size(),
+                mc_map->caches().size());
+      if (const auto* cache = mc_index->within(c.rpos2D(), mc_prox_dist)) {
+        result = { cache->id(),
+                   cache->rcenter2D(),
+                   cache->rcenter2D() - c.rpos2D() };
+      }
+      mc_map->maybe_unlock_rd(mc_map->cache_mtx(), need_lock);
+      return result;
+    }
     for (const auto* cache : mc_map->caches()) {
       if (mc_prox_dist >= (cache->rcenter2D() - c.rpos2D()).length()) {
         result = { cache->id(),
@@ -151,11 +170,17 @@ class prox_checker : public rer::client<prox_checker> {
        * the index position of cache i to be the same as its ID, so we need to
        * search for the correct cache.
        */
-    auto it = std::find_if(mc_map->caches().begin(),
-                           mc_map->caches().end(),
-                           [&](const auto& c) { return c->id() == cache_id; });
+    carepr::arena_cache* cache = nullptr;
+    if (nullptr != mc_index) {
+      cache = mc_index->find(cache_id);
+    } else {
+      auto it = std::find_if(mc_map->caches().begin(),
+                             mc_map->caches().end(),
+                             [&](const auto& c) { return c->id() == cache_id; });
+      cache = *it;
+    }
 
-    fccd2::events::cache_proximity_visitor prox_op(*it);
+    fccd2::events::cache_proximity_visitor prox_op(cache);
     prox_op.visit(controller);
     mc_map->maybe_unlock_rd(mc_map->cache_mtx(), need_lock);
     return true;
@@ -165,6 +190,7 @@ class prox_checker : public rer::client<prox_checker> {
   /* clang-format off */
   const rtypes::spatial_dist       mc_prox_dist;
   const carena::caching_arena_map* mc_map;
+  const cache_index*               mc_index;
   /* clang-format on */
 };
 
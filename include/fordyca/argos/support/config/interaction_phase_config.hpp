@@ -0,0 +1,54 @@
+/**
+ * \file interaction_phase_config.hpp
+ *
+ * \copyright 2022 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#pragma once
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "rcppsw/config/base_config.hpp"
+
+#include "fordyca/fordyca.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, argos, support, config);
+
+/*******************************************************************************
+ * Structure Definitions
+ ******************************************************************************/
+/**
+ * \struct interaction_phase_config
+ * \ingroup argos support config
+ *
+ * \brief Configuration for how robot interactions with the arena are
+ * processed by the loop functions each timestep.
+ */
+struct interaction_phase_config final : public rconfig::base_config {
+  /**
+   * Process all robot interactions serially in a fixed robot order before
+   * collecting robot metrics in parallel, rather than interacting and
+   * collecting robot by robot in parallel.
+   */
+  bool serial{false};
+};
+
+NS_END(config, support, argos, fordyca);
@@ -0,0 +1,50 @@
+/**
+ * \file perception_phase_config.hpp
+ *
+ * \copyright 2022 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#pragma once
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "rcppsw/config/base_config.hpp"
+
+#include "fordyca/fordyca.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, argos, support, config);
+
+/*******************************************************************************
+ * Structure Definitions
+ ******************************************************************************/
+/**
+ * \struct perception_phase_config
+ * \ingroup argos support config
+ *
+ * \brief Configuration for updating the perception of all robots in a
+ * dedicated phase in the loop functions, rather than as part of each robot's
+ * control step.
+ */
+struct perception_phase_config final : public rconfig::base_config {
+  bool enable{false};
+};
+
+NS_END(config, support, argos, fordyca);
@@ -0,0 +1,77 @@
+/**
+ * \file perception_phase_parser.hpp
+ *
+ * \copyright 2022 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#pragma once
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <string>
+#include <memory>
+
+#include "rcppsw/config/xml/xml_config_parser.hpp"
+
+#include "fordyca/fordyca.hpp"
+#include "fordyca/argos/support/config/perception_phase_config.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, argos, support, config);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class perception_phase_parser
+ * \ingroup argos support config
+ *
+ * \brief Parses XML parameters for updating robot perception in the loop
+ * functions into \ref perception_phase_config.
+ */
+class perception_phase_parser final: public rer::client<perception_phase_parser>,
+                                     public rconfig::xml::xml_config_parser {
+ public:
+  using config_type = perception_phase_config;
+
+  perception_phase_parser(void)
+      : ER_CLIENT_INIT("fordyca.argos.support.config.perception_phase_parser") {}
+
+  /**
+   * \brief The root tag that all perception phase parameters should lie under
+   * in the XML tree.
+   */
+  static inline const std::string kXMLRoot = "perception_phase";
+
+  void parse(const ticpp::Element& node) override RCPPSW_COLD;
+
+  RCPPSW_COLD std::string xml_root(void) const override { return kXMLRoot; }
+
+ private:
+  RCPPSW_COLD const rconfig::base_config* config_get_impl(void) const override {
+    return m_config.get();
+  }
+
+  /* clang-format off */
+  std::unique_ptr<config_type> m_config{nullptr};
+  /* clang-format on */
+};
+
+NS_END(config, support, argos, fordyca);
@@ -130,21 +130,26 @@ private:
    * \brief Process a single robot on a timestep, before running its controller:
    *
    * - Set its new position, time from ARGoS and send it its LOS.
+   * - Update its perception from its new LOS, if configured.
    *
    * \note These operations are done in parallel for all robots (lock free).
    */
   void robot_pre_step(chal::robot& robot);
 
   /**
-   * \brief Process a single robot on a timestep, after running its controller.
+   * \brief Have a single robot interact with the environment on a timestep,
+   * after running its controller.
    *
-   * - Have it interact with the environment.
-   * - Collect metrics from it.
-   *
-   * \note These operations are done in parallel for all robots (with mutual
-   *       exclusion as needed).
+   * \note Depending on configuration, this is done either in parallel for all
+   *       robots (with mutual exclusion as needed), or serially.
+   */
+  void robot_interact(controller::foraging_controller* controller);
+
+  /**
+   * \brief Collect metrics from a single robot on a timestep, after it has
+   * interacted with the environment.
    */
-  void robot_post_step(chal::robot& robot);
+  void robot_metrics_collect(controller::foraging_controller* controller);
 
   /* clang-format off */
   std::unique_ptr<fametrics::d0::d0_metrics_manager> m_metrics_manager;
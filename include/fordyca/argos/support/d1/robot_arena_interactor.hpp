@@ -100,7 +100,7 @@ class robot_arena_interactor final
                         p.envd,
                         p.cache_manager,
                         p.loop),
-        m_existing_cache_drop(p.map, p.envd) {}
+        m_existing_cache_drop(p.map, p.envd, p.cache_manager) {}
 
   robot_arena_interactor(robot_arena_interactor&&) = default;
 
@@ -96,6 +96,18 @@ class static_cache_manager final : public fascaches::base_manager,
   /**
    * \brief Allocate blocks for static cache(s) re-creation.
    *
+   * Allocation is done in two phases:
+   *
+   * 1. The blocks within the extent of each cache-to-be are calculated. This
+   *    only depends on the cache location, so it is done for all caches
+   *    up front.
+   *
+   * 2. Blocks are claimed by each cache-to-be in order of cache index (lower
+   *    index = higher priority): first the next blocks which are not within
+   *    the extent of ANY cache-to-be, then (absorption) all blocks within its
+   *    own extent not already claimed. If the blocks claimed are not enough
+   *    to create the cache, its claims are released.
+   *
    * \param c_usable_blocks Vector of blocks available to use to create caches.
    * \param c_absorbable_blocks Vector of blocks available to absorb into newly
    *                            created caches (i.e., blocks which are in the
@@ -111,22 +123,37 @@ class static_cache_manager final : public fascaches::base_manager,
       const cds::block3D_vectorno& c_usable_blocks,
       const cds::block3D_htno& c_absorbable_blocks) const;
 
+  /**
+   * \brief Calculate the absorbable blocks within the extent of each
+   * cache-to-be.
+   */
+  std::vector<cds::block3D_vectorno> sites_blocks_calc(
+      const cds::block3D_htno& c_absorbable_blocks) const;
+
+  /**
+   * \brief Calculate the absorbable blocks within the extent of the
+   * cache-to-be at the specified location.
+   */
+  cds::block3D_vectorno site_i_blocks_calc(
+      const cds::block3D_htno& c_absorbable_blocks,
+      const rmath::vector2d& c_center) const;
+
   /**
    * \brief Allocate the blocks that should be used when re-creating cache i.
    *
+   * \param c_initial_blocks The blocks initially allocated to cache i.
+   * \param c_site_blocks The blocks within the extent of cache i.
    * \param c_alloc_map Blocks that have already been allocated to the
    *                    re-creation of other static caches this timestep.
    * \param c_center The location the new cache is to be created at, in real
    *                 coordinates.
-   * \param required_blocks How many blocks to try to allocate for cache i.
    */
   boost::optional<cds::block3D_vectorno> cache_i_blocks_alloc(
-      const cds::block3D_vectorno& c_usable_blocks,
-      const cds::block3D_htno& c_absorbable_blocks,
+      const cds::block3D_vectorno& c_initial_blocks,
+      const cds::block3D_vectorno& c_site_blocks,
       const ds::block_alloc_map& c_alloc_map,
       const rmath::vector2d& c_center,
-      size_t cache_index,
-      size_t required_blocks) const;
+      size_t cache_index) const;
 
   bool cache_i_blocks_alloc_check(const cds::block3D_vectorno& cache_i_blocks,
                                   const rmath::vector2d& c_center) const;
@@ -142,13 +169,7 @@ class static_cache_manager final : public fascaches::base_manager,
    */
   bool block_alloc_usable_filter(
       const crepr::sim_block3D* block,
-      const cads::acache_vectorno& existing_caches,
-      const cfds::block3D_cluster_vectorro&) const;
-
-  cds::block3D_vectorno cache_i_alloc_from_usable(
-      const cds::block3D_vectorno& c_usable_blocks,
-      const ds::block_alloc_map& c_alloc_map,
-      size_t required_blocks) const;
+      const block_membership& membership) const;
 
   /*
    * \brief Calculate the blocks eligible to be considered for absorbtion during
@@ -165,15 +186,7 @@ class static_cache_manager final : public fascaches::base_manager,
    */
   bool block_alloc_absorbable_filter(
       const crepr::sim_block3D* block,
-      const cads::acache_vectorno& existing_caches,
-      const cfds::block3D_cluster_vectorro&);
-
-  cds::block3D_htno cache_i_alloc_from_absorbable(
-      const cds::block3D_htno& c_absorbable_blocks,
-      const cds::block3D_vectorno& c_cache_i_blocks,
-      const ds::block_alloc_map& c_alloc_map,
-      const rmath::vector2d& c_center) const;
-
+      const block_membership& membership) const;
 
   /* clang-format off */
   const std::vector<rmath::vector2d>  mc_cache_locs;
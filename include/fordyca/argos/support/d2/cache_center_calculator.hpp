@@ -37,7 +37,6 @@
 #include "rcppsw/er/client.hpp"
 #include "rcppsw/math/vector2.hpp"
 #include "rcppsw/types/spatial_dist.hpp"
-#include "rcppsw/math/rng.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -61,11 +60,19 @@ NS_START(fordyca, argos, support, d2);
  * - The blocks that should be included the cache (initial guess for center is
  *   the average x/y coordinates of elements in this list).
  * - Existing caches that need to be avoided during placement.
+ *
+ * Entities are rasterized into a grid of forbidden cache centers (i.e., each
+ * entity is dilated by the cache dimension), and the center is the nearest
+ * free cell to the initial guess. The arena boundaries and nests never change,
+ * so they are rasterized once at construction, and a single calculator is
+ * used for all creation passes. Clusters are rasterized at the start of each
+ * pass via \ref pass_begin(), and caches which are planned but do not exist
+ * yet can be added to the raster for the rest of the pass via \ref
+ * reserve(). Existing caches are added/removed from the raster for each
+ * calculation.
  */
 class cache_center_calculator : public rer::client<cache_center_calculator> {
  public:
-  static constexpr size_t kOVERLAP_SEARCH_MAX_TRIES = 100;
-
   /**
    * \brief Initialize a new cache calculator.
    *
@@ -73,82 +80,88 @@ class cache_center_calculator : public rer::client<cache_center_calculator> {
    * \param cache_dim Dimension of the cache (caches are square so can use a
    *                  scalar).
    * \param nests The nests in the arena.
-   * \param c_clusters Vector of block clusters in the area.
    */
   cache_center_calculator(cads::arena_grid* grid,
                           const rtypes::spatial_dist& cache_dim,
-                          const cads::nest_vectorro& c_nests,
-                          const cfds::block3D_cluster_vectorro& c_clusters);
+                          const cads::nest_vectorro& c_nests);
 
   cache_center_calculator(const cache_center_calculator&) = delete;
   cache_center_calculator& operator=(const cache_center_calculator&) = delete;
 
+  /**
+   * \brief Start a new creation pass: remove the clusters and reservations
+   * from the previous pass (if any) from the raster, and add the specified
+   * clusters.
+   *
+   * \param c_clusters Vector of block clusters in the area.
+   */
+  void pass_begin(const cfds::block3D_cluster_vectorro& c_clusters);
+
   /**
    * \brief Calculate the center of the new cache that will be constructed from
    * the specified blocks.
    *
    * Ideally that will be just the average of the x and y coordinates of all the
    * constituent blocks. However, it is possible that placing a cache at that
-   * location will cause it to overlap with other caches, and so corrections may
-   * be necessary.
+   * location will cause it to overlap with other caches, nests, clusters, or
+   * the arena boundaries, in which case the closest conflict free location is
+   * used.
    *
    * \param c_cache_i_blocks The list of blocks to create a new cache from.
    * \param c_existing_caches Vector of existing caches in the arena.
-   * \param rng RNG to use duration cache center calculation (guess and check if
-   *            initial computed location does not work).
    *
    * \return Coordinates of the new cache, if any were found.
    */
   boost::optional<rmath::vector2d> operator()(
       const cds::block3D_vectorno& c_cache_i_blocks,
-      const cads::acache_vectorno& c_existing_caches,
-      rmath::rng* rng) const;
+      const cads::acache_vectorno& c_existing_caches);
+
+  /**
+   * \brief Forbid cache centers which would cause a cache to overlap a cache
+   * (which does not exist yet) with the specified center for all subsequent
+   * calculations in the current pass.
+   */
+  void reserve(const rmath::vector2d& c_center);
 
  private:
   /**
-   * \brief Deconflict the guessed cache center from overlap with existing
-   * caches and blocks that are not going to be part of the cache.
-   *
-   * \return An updated cache center, if one is needed.
+   * \brief Get the indices of the cells which a cache center cannot be placed
+   * in without the cache overlapping the specified entity.
    */
-  boost::optional<rmath::vector2d> deconflict_loc(
-      const cads::acache_vectorno& c_existing_caches,
-      const rmath::vector2d& c_center,
-      rmath::rng* rng) const;
+  std::vector<size_t> conflict_cells(const crepr::entity2D* ent) const;
 
   /**
-   * \brief Given the size of the cache-to-be and its tentative location in the
-   * arena, possibily return a new location that does not overlap arena
-   * boundaries if the current one does.
-   *
-   * \param center The tentative location of the cache. It is an integer
-   *               location, but it is a *REAL* location (i.e. not
-   *               discretized).
+   * \brief Add/remove the specified cells to/from the forbidden raster.
    */
-  boost::optional<rmath::vector2d> deconflict_loc_boundaries(
-      const rmath::vector2d& c_center) const;
+  void forbidden_update(const std::vector<size_t>& c_cells, int delta);
 
   /**
-   * \brief Given an existing entity (cache or a block) that must be avoided
-   * during placement, the tentatitive location of the cache-to-be and its
-   * dimensions, possibly return a new cache center if the current location
-   * causes an overlap.
-   *
-   * \param center The tentative location of the cache. It is an integer
-   *               location, but it is a *REAL* location (i.e. not
-   *               discretized).
+   * \brief Find the closest cell to the initial guess that is not forbidden,
+   * searching outward in rings. Ties are broken in scan order, so the result
+   * is deterministic.
    */
-  boost::optional<rmath::vector2d> deconflict_loc_entity(
-      const crepr::entity2D* ent,
-      const rmath::vector2d& c_center,
-      rmath::rng* rng) const;
+  boost::optional<rmath::vector2z> nearest_free_cell(
+      const rmath::vector2z& c_guess) const;
+
+  rmath::vector2d cell_center(const rmath::vector2z& c_cell) const;
+  size_t cell_index(size_t x, size_t y) const {
+    return y * m_grid->xdsize() + x;
+  }
 
   /* clang-format off */
-  const rtypes::spatial_dist         mc_cache_dim;
-  const cads::nest_vectorro          mc_nests;
-  const cfds::block3D_cluster_vectorro mc_clusters;
+  const rtypes::spatial_dist     mc_cache_dim;
+  const cads::nest_vectorro      mc_nests;
+
+  cads::arena_grid*              m_grid;
+  cfds::block3D_cluster_vectorro m_clusters{};
+  std::vector<uint16_t>          m_forbidden;
 
-  cads::arena_grid*                  m_grid;
+  /**
+   * \brief The cells added to the raster for the clusters and reservations in
+   * the current pass, so they can be removed without re-rasterizing the
+   * entire arena.
+   */
+  std::vector<size_t>            m_pass_cells{};
   /* clang-format on */
 };
 NS_END(d2, support, argos, fordyca);
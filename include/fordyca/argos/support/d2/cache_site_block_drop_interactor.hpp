@@ -73,7 +73,9 @@ class cache_site_block_drop_interactor : public rer::client<
         m_cache_manager(cache_manager),
         m_penalty_handler(envd->penalty_handler(
             tv::block_op_src::ekCACHE_SITE_DROP)),
-        m_prox_checker(map_in, m_cache_manager->cache_proximity_dist()) {}
+        m_prox_checker(map_in,
+                       m_cache_manager->cache_proximity_dist(),
+                       m_cache_manager->caches_index()) {}
 
   cache_site_block_drop_interactor(
       cache_site_block_drop_interactor&&) = default;
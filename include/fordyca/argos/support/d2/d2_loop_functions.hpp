@@ -27,6 +27,7 @@
 #include <memory>
 #include <mutex>
 
+#include "cosm/arena/ds/cache_vector.hpp"
 #include "cosm/controller/operations/task_id_extract.hpp"
 
 #include "fordyca/argos/support/d1/d1_loop_functions.hpp"
@@ -121,10 +122,25 @@ class d2_loop_functions final : public d1::d1_loop_functions,
    * result of a robot block drop. If \c FALSE, then consider dynamic cache
    * creation in other situations.
    *
-   * \return \c TRUE if one or more caches were created, \c FALSE otherwise.
+   * \return \c TRUE if one or more caches were created, \c FALSE
+   * otherwise. If creation is asynchronous, \c TRUE if planning was started
+   * (the result of creation is reported by \ref cache_creation_commit()).
    */
   bool cache_creation_handle(bool on_drop) RCPPSW_COLD;
 
+  /**
+   * \brief Create the dynamic caches planned asynchronously after a robot block
+   * drop (if any), once robots have interacted with the arena this timestep.
+   *
+   * \return \c TRUE if one or more caches were created, \c FALSE otherwise.
+   */
+  bool cache_creation_commit(void);
+
+  /**
+   * \brief Add newly created dynamic caches to the arena.
+   */
+  void caches_created_add(const cads::acache_vectoro& created);
+
   /**
    * \brief Extract the numerical ID of the task each robot is currently
    * executing for use in convergence calculations.
@@ -141,16 +157,21 @@ class d2_loop_functions final : public d1::d1_loop_functions,
    * \brief Process a single robot on a timestep, before running its controller:
    *
    * - Set its new position, time, LOS from ARGoS.
+   * - Update its perception from its new LOS, if configured.
    */
   void robot_pre_step(chal::robot& robot);
 
   /**
-   * \brief Process a single robot on a timestep, after running its controller:
-   *
-   * - Have  it interact with the environment.
-   * - Collect metrics from it.
+   * \brief Have a single robot interact with the environment on a timestep,
+   * after running its controller, flagging dynamic cache creation if needed.
+   */
+  void robot_interact(controller::foraging_controller* controller);
+
+  /**
+   * \brief Collect metrics from a single robot on a timestep, after it has
+   * interacted with the environment.
    */
-  void robot_post_step(chal::robot& robot);
+  void robot_metrics_collect(controller::foraging_controller* controller);
 
   /* clang-format off */
   std::mutex                                         m_dynamic_cache_mtx{};
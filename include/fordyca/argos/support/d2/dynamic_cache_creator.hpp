@@ -24,13 +24,14 @@
  * Includes
  ******************************************************************************/
 #include <memory>
-
-#include "rcppsw/math/rng.hpp"
+#include <vector>
+#include <boost/optional.hpp>
 
 #include "cosm/foraging/ds/block_cluster_vector.hpp"
 #include "cosm/ds/block3D_ht.hpp"
 
 #include "fordyca/argos/support/caches/base_creator.hpp"
+#include "fordyca/argos/support/d2/cache_center_calculator.hpp"
 #include "fordyca/fordyca.hpp"
 
 /*******************************************************************************
@@ -40,6 +41,10 @@ namespace cosm::arena {
 class caching_arena_map;
 } /* namespace cosm::arena */
 
+namespace fordyca::argos::support::caches {
+class creation_verifier;
+} /* namespace fordyca::argos::support::caches */
+
 NS_START(fordyca, argos, support, d2);
 
 /*******************************************************************************
@@ -58,6 +63,11 @@ NS_START(fordyca, argos, support, d2);
  * simulations. Verification of validity is only possible AFTER creation, so if
  * a newly created cache is found to be invalid, it is discarded and the process
  * of its creation reversed.
+ *
+ * Creation is split into planning where caches should go and which blocks they
+ * should contain (\ref plan_all(), which does not modify the arena), and
+ * realizing those plans in the arena (\ref realize_all()), so that planning can
+ * be done while the arena is not being modified, but robots are running.
  */
 class dynamic_cache_creator : public fascaches::base_creator,
                               public rer::client<dynamic_cache_creator> {
@@ -69,11 +79,41 @@ class dynamic_cache_creator : public fascaches::base_creator,
     rtypes::spatial_dist       min_dist;
     uint                       min_blocks;
     bool                       strict_constraints;
+
+    /**
+     * \brief Should the caches created during this pass be audited?
+     */
+    bool                       audit;
+
+    /**
+     * \brief The cache center calculator, which is kept across creation passes
+     * so that the parts of the arena which never change only need to be
+     * rasterized once. Only used during planning.
+     */
+    cache_center_calculator*   calculator;
     /* clang-format on */
   };
 
+  /**
+   * \brief A cache to be created: where, and from which blocks.
+   */
+  struct cache_plan {
+    rmath::vector2d              center{};
+    cds::block3D_vectorno        blocks{};
 
-  dynamic_cache_creator(const params* p, rmath::rng* rng);
+    /**
+     * \brief The discrete anchors of \ref blocks when the plan was made, so
+     * that blocks which have since moved can be detected.
+     */
+    std::vector<rmath::vector2z> anchors{};
+  };
+
+  struct plan_result {
+    std::vector<cache_plan> plans{};
+    size_t n_discarded{};
+  };
+
+  explicit dynamic_cache_creator(const params* p);
   dynamic_cache_creator(const dynamic_cache_creator&) = delete;
   dynamic_cache_creator& operator=(const dynamic_cache_creator&) = delete;
 
@@ -99,24 +139,52 @@ class dynamic_cache_creator : public fascaches::base_creator,
                              cds::block3D_vectorno&& usable_blocks,
                              cds::block3D_htno&& absorbable_blocks);
 
+  /**
+   * \brief Plan the caches to create from blocks that are close enough
+   * together, without modifying the arena. Parameters are the same as for
+   * \ref create_all().
+   *
+   * The arena must not be modified while planning is in progress, but planning
+   * can be run in parallel with anything that only reads it.
+   */
+  plan_result plan_all(const fascaches::create_ro_params& c_params,
+                       cds::block3D_vectorno&& usable_blocks,
+                       cds::block3D_htno&& absorbable_blocks);
+
+  /**
+   * \brief Create and verify the planned caches in the arena.
+   *
+   * Blocks which have been picked up or have moved since a cache was planned
+   * are dropped from it, and if that leaves too few blocks the cache is
+   * discarded.
+   *
+   * \param c_params The current state of the arena (may be different than when
+   *                 the caches were planned).
+   * \param planned The planned caches.
+   * \param c_all_blocks All blocks in the arena not carried by robots or in
+   *                     existing caches.
+   */
+  creation_result realize_all(const fascaches::create_ro_params& c_params,
+                              plan_result&& planned,
+                              const cds::block3D_vectorno& c_all_blocks);
+
  private:
   struct cache_i_result {
-    bool status{false};
     std::shared_ptr<carepr::arena_cache> cache{nullptr};
     cds::block3D_vectorno used{};
   };
 
   /**
-   * \brief Calculate the blocks to be used in the creation of a single new
-   * cache.
+   * \brief Partition the usable blocks into the sets of blocks to be used in the
+   * creation of each new cache, such that any two blocks within the minimum
+   * distance of each other are in the same set, as long as that does not make
+   * the set span more than max(cache dimension, minimum distance) in X or Y.
    *
    * \param c_usable_blocks The total list of all blocks available for cache
    *                        creation when the creator was called.
-   * \param anchor The current anchor block.
    */
-  cds::block3D_vectorno cache_i_blocks_alloc(
-      const cds::block3D_vectorno& c_usable_blocks,
-      cds::block3D_vectorno::iterator anchor) const;
+  std::vector<cds::block3D_vectorno> cache_blocks_cluster(
+      const cds::block3D_vectorno& c_usable_blocks) const;
 
   /**
    * \brief Calculate the blocks a cache will absorb as a result of its center
@@ -139,42 +207,51 @@ class dynamic_cache_creator : public fascaches::base_creator,
       const rtypes::spatial_dist& c_cache_dim) const;
 
   /**
-   * \brief Create the set of caches that our new cache needs to avoid during
-   * placement from the set of caches that existed prior to this invocation of
-   * the creator + the set of caches we have created thus far during invocation.
+   * \brief Plan a cache, once blocks have been allocated for it: find a
+   * conflict free center, and the blocks it will absorb there.
+   *
+   * \return The plan, if a center could be found.
    */
-  cads::acache_vectorno avoidance_caches_calc(
-      const cads::acache_vectorno& c_previous_caches,
-      const cads::acache_vectoro& c_created_caches) const;
-
+  boost::optional<cache_plan> cache_i_plan(
+      const fascaches::create_ro_params& c_params,
+      const cds::block3D_vectorno& c_alloc_blocks,
+      const cds::block3D_htno& c_absorbable_blocks,
+      cache_center_calculator* calculator) const;
 
   /**
-   * \brief Do the actual creation of a cache, once blocks have been allocated
-   * for it.
+   * \brief Drop blocks which have been picked up or have moved since the cache
+   * was planned.
    *
-   * \return \c TRUE if creation was successful, and \c FALSE otherwise.
+   * \return \c TRUE if enough blocks are left to create the cache, and \c
+   * FALSE otherwise.
+   */
+  bool cache_i_revalidate(cache_plan* plan) const;
+
+  /**
+   * \brief Do the actual creation of a planned cache.
    */
   cache_i_result cache_i_create(const fascaches::create_ro_params& c_params,
-                                const cds::block3D_vectorno& c_alloc_blocks,
-                                const cds::block3D_htno& c_absorbable_blocks,
-                                cads::acache_vectoro* created_caches);
+                                cache_plan&& plan);
   /**
    * \brief If a newly created cache failed verification checks, delete it.
    *
    * 1. Clear host cell.
-   * 2. Redistribute the blocks that have been deposited in the host cell.
+   * 2. Redistribute the blocks that have been deposited in the host cell,
+   *    updating their locations in the \p verifier's block index.
    *
    * Then the actual cache can safely be deleted.
    */
-  void cache_delete(const cache_i_result& cache_i);
+  void cache_delete(const cache_i_result& cache_i,
+                    fascaches::creation_verifier* verifier);
 
   /* clang-format off */
   const uint                 mc_min_blocks;
   const rtypes::spatial_dist mc_min_dist;
   const bool                 mc_strict_constraints;
+  const bool                 mc_audit;
 
-  rmath::rng*                m_rng;
   carena::caching_arena_map* m_map;
+  cache_center_calculator*   m_calculator;
   /* clang-format on */
 };
 
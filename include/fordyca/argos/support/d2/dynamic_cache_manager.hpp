@@ -24,8 +24,8 @@
  * Includes
  ******************************************************************************/
 #include <algorithm>
+#include <future>
 
-#include "rcppsw/math/rng.hpp"
 #include "rcppsw/er/client.hpp"
 
 #include "cosm/ds/block3D_vector.hpp"
@@ -35,6 +35,8 @@
 #include "fordyca/argos/support/caches/create_ro_params.hpp"
 #include "fordyca/argos/support/caches/config/caches_config.hpp"
 #include "fordyca/argos/support/caches/base_manager.hpp"
+#include "fordyca/argos/support/d2/cache_center_calculator.hpp"
+#include "fordyca/argos/support/d2/dynamic_cache_creator.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -54,13 +56,17 @@ NS_START(fordyca, argos, support, d2);
  *
  * \brief Manager for creation, depletion, and metric gathering for dynamic
  * caches in the arena.
+ *
+ * Caches can be created synchronously via \ref create(), or asynchronously:
+ * \ref create_async() plans the caches to create on a background thread, which
+ * must be finished via \ref creation_await() before the arena is next modified,
+ * after which the planned caches are created via \ref creation_commit().
  */
 class dynamic_cache_manager final : public fascaches::base_manager,
                                     public rer::client<dynamic_cache_manager> {
  public:
   dynamic_cache_manager(const fascaches::config::caches_config* config,
-                        carena::caching_arena_map* arena_map,
-                        rmath::rng* rng);
+                        carena::caching_arena_map* arena_map);
   dynamic_cache_manager(const dynamic_cache_manager&) = delete;
   dynamic_cache_manager& operator=(const dynamic_cache_manager&) = delete;
 
@@ -73,6 +79,40 @@ class dynamic_cache_manager final : public fascaches::base_manager,
   boost::optional<cads::acache_vectoro> create(const fascaches::create_ro_params& c_params,
                                               const cds::block3D_vectorno&  c_all_blocks);
 
+  /**
+   * \brief Start planning the caches to create in the arena according to free
+   * block configurations on a background thread. The arena must not be modified
+   * until \ref creation_await() has been called.
+   *
+   * \return \c TRUE if planning was started, \c FALSE if there were no blocks
+   * eligible for cache creation.
+   */
+  bool create_async(const fascaches::create_ro_params& c_params,
+                    const cds::block3D_vectorno& c_all_blocks);
+
+  /**
+   * \brief Wait for cache creation planning started via \ref create_async() to
+   * finish, if any is in progress.
+   */
+  void creation_await(void);
+
+  /**
+   * \brief Wait for and then discard any cache creation planning started via
+   * \ref create_async() (e.g., because the arena is being reset).
+   */
+  void creation_abandon(void);
+
+  /**
+   * \brief Create the caches planned via \ref create_async() (if any) in the
+   * arena, after revalidating them against the current state of the arena.
+   *
+   * \return The created caches (possibly none), or nothing if no caches were
+   * planned.
+   */
+  boost::optional<cads::acache_vectoro> creation_commit(
+      const fascaches::create_ro_params& c_params,
+      const cds::block3D_vectorno& c_all_blocks);
+
   /**
    * \brief Get the minimum distance that must be maintained between two caches
    * in order for them to discrete. Equal to the maximum of (twice the cache
@@ -84,6 +124,15 @@ class dynamic_cache_manager final : public fascaches::base_manager,
   }
 
  private:
+  dynamic_cache_creator::params creator_params(void);
+
+  /**
+   * \brief Update metrics, and configure the extents of newly created caches.
+   */
+  boost::optional<cads::acache_vectoro> creation_finish(
+      dynamic_cache_creator* creator,
+      dynamic_cache_creator::creation_result&& res);
+
   /*
    * \brief Filter blocks eligible to be considered for cache
    * creation. Only blocks that are not:
@@ -96,8 +145,7 @@ class dynamic_cache_manager final : public fascaches::base_manager,
    */
   bool block_alloc_usable_filter(
       const crepr::sim_block3D* block,
-      const cads::acache_vectorno& existing_caches,
-      const cfds::block3D_cluster_vectorro& clusters);
+      const block_membership& membership) const;
 
   /*
    * \brief Calculate the blocks eligible to be considered for absorbtion during
@@ -114,12 +162,19 @@ class dynamic_cache_manager final : public fascaches::base_manager,
    */
   bool block_alloc_absorbable_filter(
       const crepr::sim_block3D* block,
-      const cads::acache_vectorno& existing_caches,
-      const cfds::block3D_cluster_vectorro&);
+      const block_membership& membership) const;
 
   /* clang-format off */
-  rmath::rng*                         m_rng;
-  carena::caching_arena_map*          m_map;
+  carena::caching_arena_map*                     m_map;
+  cache_center_calculator                        m_calculator;
+  std::future<dynamic_cache_creator::plan_result> m_planning{};
+  boost::optional<dynamic_cache_creator::plan_result> m_planned{};
+
+  /**
+   * \brief The # of creation passes which have created caches in the arena,
+   * for determining when to audit the created caches.
+   */
+  size_t                                         m_n_passes{0};
   /* clang-format on */
 };
 
@@ -70,7 +70,9 @@ class new_cache_block_drop_interactor : public rer::client<
         m_cache_manager(cache_manager),
         m_penalty_handler(envd->penalty_handler(
             tv::block_op_src::ekNEW_CACHE_DROP)),
-        m_prox_checker(map_in, m_cache_manager->cache_proximity_dist()) {}
+        m_prox_checker(map_in,
+                       m_cache_manager->cache_proximity_dist(),
+                       m_cache_manager->caches_index()) {}
 
   new_cache_block_drop_interactor(
       new_cache_block_drop_interactor&&) = default;
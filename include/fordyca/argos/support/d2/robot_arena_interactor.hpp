@@ -101,7 +101,7 @@ class robot_arena_interactor final : public rer::client<robot_arena_interactor<T
                         p.envd,
                         p.cache_manager,
                         p.loop),
-        m_existing_cache_drop(p.map, p.envd),
+        m_existing_cache_drop(p.map, p.envd, p.cache_manager),
         m_cache_site_drop(p.map,
                           p.floor,
                           p.envd,
@@ -32,6 +32,7 @@
 #include "rcppsw/types/type_uuid.hpp"
 
 #include "fordyca/controller/config/block_sel/block_sel_matrix_config.hpp"
+#include "fordyca/controller/cognitive/sel_exception_set.hpp"
 #include "fordyca/fordyca.hpp"
 
 /*******************************************************************************
@@ -50,6 +51,33 @@ using block_sel_variant =
                    std::vector<rtypes::type_uuid>,
                    config::block_sel::block_pickup_policy_config>;
 
+/*******************************************************************************
+ * Struct Definitions
+ ******************************************************************************/
+/**
+ * \struct block_sel_fields
+ * \ingroup controller cognitive
+ *
+ * \brief Typed contents of the \ref block_sel_matrix, so that lookups during
+ * block selection/acquisition are plain field accesses rather than string
+ * lookups + variant unpacking.
+ */
+struct block_sel_fields {
+  enum pickup_policy_type {
+    ekPICKUP_POLICY_NULL,
+    ekPICKUP_POLICY_CLUSTER_PROX
+  };
+
+  /* clang-format off */
+  rmath::vector2d                               nest_loc{};
+  double                                        cube_priority{0.0};
+  double                                        ramp_priority{0.0};
+  sel_exception_set                             sel_exceptions{};
+  config::block_sel::block_pickup_policy_config pickup_policy{};
+  pickup_policy_type                            pickup_type{ekPICKUP_POLICY_NULL};
+  /* clang-format on */
+};
+
 /*******************************************************************************
  * Class Definitions
  ******************************************************************************/
@@ -61,6 +89,10 @@ using block_sel_variant =
  * functions to calculate the best:
  *
  * - block (of whatever type)
+ *
+ * Selection code should use \ref fields(); the string-keyed entries are kept
+ * for compatibility with existing consumers, and are read-only outside of this
+ * class.
  */
 class block_sel_matrix : public std::map<std::string, block_sel_variant> {
  public:
@@ -98,6 +130,13 @@ class block_sel_matrix : public std::map<std::string, block_sel_variant> {
    * that block up again as part of a task).
    */
   void sel_exceptions_clear(void);
+
+  const block_sel_fields& fields(void) const { return m_fields; }
+
+ private:
+  /* clang-format off */
+  block_sel_fields m_fields{};
+  /* clang-format on */
 };
 
 NS_END(cognitive, controller, fordyca);
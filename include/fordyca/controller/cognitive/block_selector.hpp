@@ -24,11 +24,13 @@
  * Includes
  ******************************************************************************/
 #include <list>
+#include <vector>
 
 #include "rcppsw/er/client.hpp"
 #include "rcppsw/math/vector2.hpp"
 
 #include "fordyca/controller/cognitive/block_sel_matrix.hpp"
+#include "fordyca/math/utility_batch.hpp"
 #include "fordyca/subsystem/perception/perception_fwd.hpp"
 
 /*******************************************************************************
@@ -67,7 +69,7 @@ class block_selector : public rer::client<block_selector> {
    * best block is found, and NULL.
    */
   const crepr::base_block3D* operator()(const fspds::dp_block_map& blocks,
-                                        const rmath::vector2d& position);
+                                        const rmath::vector2d& position) const;
 
  private:
   /**
@@ -88,7 +90,14 @@ class block_selector : public rer::client<block_selector> {
                          const crepr::base_block3D* block) const;
 
   /* clang-format off */
-  const block_sel_matrix* const mc_matrix;
+  const block_sel_matrix* const                   mc_matrix;
+
+  /**
+   * \brief Reused between selections, so that selection does not allocate once
+   * they have grown to hold all known blocks.
+   */
+  mutable math::utility_batch                     m_batch{};
+  mutable std::vector<const crepr::base_block3D*> m_candidates{};
   /* clang-format on */
 };
 
@@ -35,6 +35,7 @@
 
 #include "fordyca/controller/config/cache_sel/cache_sel_matrix_config.hpp"
 #include "fordyca/controller/cognitive/cache_sel_exception.hpp"
+#include "fordyca/controller/cognitive/sel_exception_set.hpp"
 #include "fordyca/fordyca.hpp"
 
 /*******************************************************************************
@@ -55,6 +56,42 @@ using cache_sel_variant =
                    config::cache_sel::cache_pickup_policy_config,
                    bool>;
 
+/*******************************************************************************
+ * Struct Definitions
+ ******************************************************************************/
+/**
+ * \struct cache_sel_fields
+ * \ingroup controller cognitive
+ *
+ * \brief Typed contents of the \ref cache_sel_matrix, so that lookups during
+ * existing cache/new cache/cache site selection and acquisition are plain
+ * field accesses rather than string lookups + variant unpacking.
+ */
+struct cache_sel_fields {
+  enum pickup_policy_type {
+    ekPICKUP_POLICY_NULL,
+    ekPICKUP_POLICY_TIME,
+    ekPICKUP_POLICY_CACHE_SIZE,
+    ekPICKUP_POLICY_CACHE_DURATION
+  };
+
+  /* clang-format off */
+  rmath::vector2d                               nest_loc{};
+  rtypes::spatial_dist                          cache_prox_dist{0.0};
+  rtypes::spatial_dist                          block_prox_dist{0.0};
+  rtypes::spatial_dist                          nest_prox_dist{0.0};
+  rtypes::spatial_dist                          cluster_prox_dist{0.0};
+  rmath::rangez                                 site_xrange{};
+  rmath::rangez                                 site_yrange{};
+  sel_exception_set                             pickup_exceptions{};
+  sel_exception_set                             drop_exceptions{};
+  config::cache_sel::cache_pickup_policy_config pickup_policy{};
+  pickup_policy_type                            pickup_type{ekPICKUP_POLICY_NULL};
+  bool                                          strict_constraints{true};
+  rtypes::spatial_dist                          new_cache_tol{0.0};
+  /* clang-format on */
+};
+
 /*******************************************************************************
  * Class Definitions
  ******************************************************************************/
@@ -71,6 +108,9 @@ using cache_sel_variant =
  *
  * This class may be separated into those components in the future if it makes
  * sense. For now, it is cleaner to have all three uses be in the same class.
+ *
+ * Selection code should use \ref fields(); the string-keyed entries are kept
+ * for compatibility with existing consumers.
  */
 class cache_sel_matrix final
     : public rer::client<cache_sel_matrix>,
@@ -121,6 +161,13 @@ class cache_sel_matrix final
    * existing cache).
    */
   void sel_exceptions_clear(void);
+
+  const cache_sel_fields& fields(void) const { return m_fields; }
+
+ private:
+  /* clang-format off */
+  cache_sel_fields m_fields{};
+  /* clang-format on */
 };
 
 NS_END(cognitive, controller, fordyca);
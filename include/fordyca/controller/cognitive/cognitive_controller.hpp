@@ -73,6 +73,22 @@ class cognitive_controller : public foraging_controller,
     return m_perception.get();
   }
 
+  /**
+   * \brief Update the perception subsystem from the robot's current LOS.
+   *
+   * Called as part of the control step, unless the loop functions update the
+   * perception of all robots in a separate phase before the control step (see
+   * \ref perception_external()).
+   */
+  virtual void perception_update(void);
+
+  /**
+   * \brief Set whether or not the robot's perception is updated by the loop
+   * functions rather than as part of its control step.
+   */
+  void perception_external(bool b) { m_perception_external = b; }
+  bool perception_external(void) const { return m_perception_external; }
+
  protected:
   /**
    * \brief Mutator to allow replacement of the perception subsystem object
@@ -86,6 +102,7 @@ class cognitive_controller : public foraging_controller,
  private:
   /* clang-format off */
   bool                                                         m_display_los{false};
+  bool                                                         m_perception_external{false};
   std::unique_ptr<fsperception::foraging_perception_subsystem> m_perception;
   /* clang-format on */
 };
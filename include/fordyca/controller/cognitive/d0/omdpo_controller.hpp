@@ -53,6 +53,10 @@ class omdpo_controller : public mdpo_controller,
 
   /* foraging_controller overrides */
   void control_step(void) override;
+
+  /* cognitive_controller overrides */
+  void perception_update(void) override;
+
   std::type_index type_index(void) const override { return typeid(*this); }
 
   void oracle_init(std::unique_ptr<fsperception::oracular_info_receptor> receptor) RCPPSW_COLD;
@@ -24,10 +24,13 @@
  * Includes
  ******************************************************************************/
 #include <list>
+#include <vector>
 
 #include "rcppsw/er/client.hpp"
 #include "rcppsw/math/vector2.hpp"
 
+#include "fordyca/ds/spatial_hash.hpp"
+#include "fordyca/math/utility_batch.hpp"
 #include "fordyca/subsystem/perception/perception_fwd.hpp"
 
 /*******************************************************************************
@@ -37,6 +40,10 @@ namespace cosm::repr {
 class base_block3D;
 } /* namespace cosm::repr */
 
+namespace cosm::arena::repr {
+class base_cache;
+} /* namespace cosm::arena::repr */
+
 NS_START(fordyca, controller, cognitive);
 class cache_sel_matrix;
 NS_START(d2);
@@ -72,12 +79,31 @@ class new_cache_selector: public rer::client<new_cache_selector> {
                                         const rmath::vector2d& position) const;
 
  private:
-  bool new_cache_is_excluded(const fspds::dp_cache_map& existing_caches,
-                             const fspds::dp_block_map& blocks,
+  using cache_index_type = fds::spatial_hash<const carepr::base_cache*>;
+  using block_index_type = fds::spatial_hash<const crepr::base_block3D*>;
+
+  /**
+   * \brief Determine if the specified new cache is excluded from being
+   * considered for selection because it is too close to a known cache or a
+   * potential block cluster (any other known block).
+   *
+   * Only the known caches/blocks in the vicinity of the new cache are checked,
+   * via per-selection spatial indices, so the cost depends on the local density
+   * of known objects rather than on the total # of known objects.
+   */
+  bool new_cache_is_excluded(const cache_index_type& caches,
+                             const block_index_type& blocks,
                              const crepr::base_block3D* new_cache) const;
 
   /* clang-format off */
   const controller::cognitive::cache_sel_matrix* const mc_matrix;
+
+  /**
+   * \brief Reused between selections, so that selection does not allocate once
+   * they have grown to hold all known new caches.
+   */
+  mutable math::utility_batch                          m_batch{};
+  mutable std::vector<const crepr::base_block3D*>      m_candidates{};
   /* clang-format on */
 };
 
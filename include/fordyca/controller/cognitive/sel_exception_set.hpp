@@ -0,0 +1,84 @@
+/**
+ * \file sel_exception_set.hpp
+ *
+ * \copyright 2022 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#pragma once
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <algorithm>
+#include <vector>
+
+#include "rcppsw/types/type_uuid.hpp"
+
+#include "fordyca/fordyca.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, controller, cognitive);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class sel_exception_set
+ * \ingroup controller cognitive
+ *
+ * \brief The set of IDs of objects which are disqualified from selection. Kept
+ * as a sorted vector: exception lists are very small (usually 0-2 entries) and
+ * are queried once per candidate object during selection, but only modified
+ * once per task.
+ */
+class sel_exception_set {
+ public:
+  sel_exception_set(void) = default;
+
+  /**
+   * \brief Add an ID to the set; adding an ID which is already present is a
+   * no-op.
+   */
+  void add(const rtypes::type_uuid& id) {
+    auto it = std::lower_bound(m_ids.begin(), m_ids.end(), id, id_less);
+    if (m_ids.end() == it || it->v() != id.v()) {
+      m_ids.insert(it, id);
+    }
+  }
+
+  bool contains(const rtypes::type_uuid& id) const {
+    return std::binary_search(m_ids.begin(), m_ids.end(), id, id_less);
+  }
+
+  void clear(void) { m_ids.clear(); }
+  bool empty(void) const { return m_ids.empty(); }
+  size_t size(void) const { return m_ids.size(); }
+
+ private:
+  static bool id_less(const rtypes::type_uuid& lhs,
+                      const rtypes::type_uuid& rhs) {
+    return lhs.v() < rhs.v();
+  }
+
+  /* clang-format off */
+  std::vector<rtypes::type_uuid> m_ids{};
+  /* clang-format on */
+};
+
+NS_END(cognitive, controller, fordyca);
@@ -23,10 +23,11 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
-#include <algorithm>
 #include <map>
+#include <vector>
 
 #include "cosm/ds/block3D_vector.hpp"
+#include "cosm/repr/sim_block3D.hpp"
 
 #include "fordyca/fordyca.hpp"
 
@@ -44,6 +45,11 @@ NS_START(fordyca, ds);
  *
  * \brief Wrapper around std::map: (cache ID, block alloc vector). For use in
  * cache creation.
+ *
+ * Alongside the per-cache allocations, a dense (block ID -> cache ID) index is
+ * maintained so that membership queries are O(1) instead of a scan over all
+ * allocations, which matters when (re)creating static caches with large
+ * numbers of blocks in the arena.
  */
 
 class block_alloc_map {
@@ -51,25 +57,48 @@ class block_alloc_map {
   using map_type = std::map<int, cds::block3D_vectorno>;
   block_alloc_map(void) = default;
 
+  /**
+   * \brief Set the blocks allocated to the specified cache, replacing any
+   * previous allocation for it.
+   */
+  void assign(int cache_id, const cds::block3D_vectorno& blocks) {
+    auto& alloc = m_decoratee[cache_id];
+    for (auto* b : alloc) {
+      m_owners[b->id().v()] = kNoCache;
+    } /* for(*b..) */
+
+    alloc = blocks;
+    for (auto* b : alloc) {
+      auto id = static_cast<size_t>(b->id().v());
+      if (id >= m_owners.size()) {
+        m_owners.resize(id + 1, kNoCache);
+      }
+      m_owners[id] = cache_id;
+    } /* for(*b..) */
+  }
+
   bool contains(const crepr::sim_block3D* block) const {
-    auto cache_i_alloc = [&](const auto& alloc_i) {
-      return alloc_i.second.end() !=
-             std::find(alloc_i.second.begin(), alloc_i.second.end(), block);
-    };
-    return std::any_of(m_decoratee.begin(), m_decoratee.end(), cache_i_alloc);
+    return kNoCache != owner(block);
   }
 
  private:
+  static constexpr const int kNoCache = -1;
+
+  int owner(const crepr::sim_block3D* block) const {
+    auto id = static_cast<size_t>(block->id().v());
+    return id < m_owners.size() ? m_owners[id] : kNoCache;
+  }
+
   const map_type& decoratee(void) const { return m_decoratee; }
   map_type& decoratee(void) { return m_decoratee; }
 
   /* clang-format off */
-  map_type m_decoratee{};
+  map_type         m_decoratee{};
+  std::vector<int> m_owners{};
   /* clang-format on */
 
  public:
   RCPPSW_WRAP_DECLDEF(at, decoratee(), const);
-  RCPPSW_WRAP_DECLDEF(operator[], decoratee());
   RCPPSW_WRAP_DECLDEF(begin, decoratee());
   RCPPSW_WRAP_DECLDEF(end, decoratee());
   RCPPSW_WRAP_DECLDEF(begin, decoratee(), const);
@@ -0,0 +1,180 @@
+/**
+ * \file spatial_hash.hpp
+ *
+ * \copyright 2022 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#pragma once
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "rcppsw/math/vector2.hpp"
+#include "rcppsw/types/spatial_dist.hpp"
+
+#include "fordyca/fordyca.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(fordyca, ds);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class spatial_hash
+ * \ingroup ds
+ *
+ * \brief Uniform grid over the plane, hashed so that only occupied buckets are
+ * stored, for finding the items near a given location without checking every
+ * item. Queries are conservative: they return all items in any bucket which
+ * overlaps the query region, so callers need to do their own exact distance or
+ * overlap checks on the results.
+ *
+ * For best results, the bucket dimension should be about the same as the query
+ * radius/the size of the items stored.
+ */
+template <typename T>
+class spatial_hash {
+ public:
+  /**
+   * \param bucket_dim The bucket dimension. If it is not positive (e.g., it is
+   *                   derived from a proximity distance which is disabled),
+   *                   unit size buckets are used.
+   */
+  explicit spatial_hash(const rtypes::spatial_dist& bucket_dim)
+      : mc_bucket_dim(bucket_dim.v() > 0.0 ? bucket_dim.v() : 1.0) {}
+
+  /**
+   * \brief Add an item whose extent spans from \p ll to \p ur to all buckets it
+   * overlaps.
+   */
+  void insert(const rmath::vector2d& ll, const rmath::vector2d& ur, const T& item) {
+    auto [xmin, ymin] = bucket(ll);
+    auto [xmax, ymax] = bucket(ur);
+    for (int64_t i = xmin; i <= xmax; ++i) {
+      for (int64_t j = ymin; j <= ymax; ++j) {
+        m_buckets[key(i, j)].push_back(item);
+      } /* for(j..) */
+    } /* for(i..) */
+    ++m_size;
+  }
+
+  /**
+   * \brief Add a point item.
+   */
+  void insert(const rmath::vector2d& pos, const T& item) {
+    insert(pos, pos, item);
+  }
+
+  /**
+   * \brief Remove an item which was added with the extent \p ll to \p ur from
+   * all buckets it was added to. Removing an item which is not present is a
+   * no-op.
+   */
+  void remove(const rmath::vector2d& ll, const rmath::vector2d& ur, const T& item) {
+    auto [xmin, ymin] = bucket(ll);
+    auto [xmax, ymax] = bucket(ur);
+    bool found = false;
+    for (int64_t i = xmin; i <= xmax; ++i) {
+      for (int64_t j = ymin; j <= ymax; ++j) {
+        auto it = m_buckets.find(key(i, j));
+        if (m_buckets.end() == it) {
+          continue;
+        }
+        auto& items = it->second;
+        auto victim = std::find(items.begin(), items.end(), item);
+        if (items.end() != victim) {
+          items.erase(victim);
+          found = true;
+        }
+      } /* for(j..) */
+    } /* for(i..) */
+    if (found) {
+      --m_size;
+    }
+  }
+
+  /**
+   * \brief Call \p cb on every item in a bucket overlapping the region from \p
+   * ll to \p ur. Items spanning multiple buckets can be visited more than
+   * once.
+   */
+  template <typename TCallback>
+  void query(const rmath::vector2d& ll,
+             const rmath::vector2d& ur,
+             const TCallback& cb) const {
+    auto [xmin, ymin] = bucket(ll);
+    auto [xmax, ymax] = bucket(ur);
+    for (int64_t i = xmin; i <= xmax; ++i) {
+      for (int64_t j = ymin; j <= ymax; ++j) {
+        auto it = m_buckets.find(key(i, j));
+        if (m_buckets.end() == it) {
+          continue;
+        }
+        for (const auto& item : it->second) {
+          cb(item);
+        } /* for(&item..) */
+      } /* for(j..) */
+    } /* for(i..) */
+  }
+
+  /**
+   * \brief Call \p cb on every item in a bucket within \p radius of \p pos.
+   */
+  template <typename TCallback>
+  void query(const rmath::vector2d& pos,
+             const rtypes::spatial_dist& radius,
+             const TCallback& cb) const {
+    rmath::vector2d offset(radius.v(), radius.v());
+    query(pos - offset, pos + offset, cb);
+  }
+
+  size_t size(void) const { return m_size; }
+  bool empty(void) const { return 0 == m_size; }
+
+  void clear(void) {
+    m_buckets.clear();
+    m_size = 0;
+  }
+
+ private:
+  std::pair<int64_t, int64_t> bucket(const rmath::vector2d& pos) const {
+    return { static_cast<int64_t>(std::floor(pos.x() / mc_bucket_dim)),
+             static_cast<int64_t>(std::floor(pos.y() / mc_bucket_dim)) };
+  }
+  static uint64_t key(int64_t i, int64_t j) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(i)) << 32) |
+           static_cast<uint32_t>(j);
+  }
+
+  /* clang-format off */
+  const double                                    mc_bucket_dim;
+  size_t                                          m_size{0};
+  std::unordered_map<uint64_t, std::vector<T>>    m_buckets{};
+  /* clang-format on */
+};
+
+NS_END(ds, fordyca);
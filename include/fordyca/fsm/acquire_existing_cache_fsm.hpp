@@ -34,6 +34,8 @@
 #include "cosm/subsystem/subsystem_fwd.hpp"
 
 #include "fordyca/fordyca.hpp"
+#include "fordyca/fsm/cache_acq_validator.hpp"
+#include "fordyca/fsm/existing_cache_selector.hpp"
 #include "fordyca/fsm/fsm_ro_params.hpp"
 #include "fordyca/subsystem/perception/perception_fwd.hpp"
 
@@ -111,7 +113,8 @@ class acquire_existing_cache_fsm : public rer::client<acquire_existing_cache_fsm
   const bool                                              mc_for_pickup;
   const controller::cognitive::cache_sel_matrix* const    mc_matrix;
   const fspds::dpo_store*                           const mc_store;
-
+  const existing_cache_selector                           m_selector;
+  const cache_acq_validator                               m_validator;
   /* clang-format on */
 };
 
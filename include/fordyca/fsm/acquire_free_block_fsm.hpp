@@ -30,6 +30,8 @@
 #include "cosm/ta/taskable.hpp"
 
 #include "fordyca/controller/cognitive/block_sel_matrix.hpp"
+#include "fordyca/controller/cognitive/block_selector.hpp"
+#include "fordyca/fsm/block_acq_validator.hpp"
 #include "fordyca/fsm/foraging_acq_goal.hpp"
 #include "fordyca/fsm/foraging_transport_goal.hpp"
 #include "fordyca/fsm/fsm_ro_params.hpp"
@@ -82,6 +84,8 @@ class acquire_free_block_fsm : public rer::client<acquire_free_block_fsm>,
   /* clang-format off */
   const controller::cognitive::block_sel_matrix* const mc_matrix;
   const fspds::dpo_store*      const                   mc_store;
+  const controller::cognitive::block_selector          m_selector;
+  const block_acq_validator                            m_validator;
   /* clang-format on */
 };
 
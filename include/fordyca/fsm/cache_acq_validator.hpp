@@ -58,6 +58,11 @@ NS_START(fsm);
  * \brief Determine if the acquisition of a cache at a specific location/with a
  * specific ID is currently valid, according to simulation parameters and
  * current simulation state.
+ *
+ * When bound to a robot's \ref fspds::dp_cache_map, caches are looked up by ID
+ * directly in the map (which is indexed by cache ID), so a validator can be
+ * constructed once and used for the lifetime of the map, without needing to
+ * snapshot the set of known caches for each validation.
  */
 class cache_acq_validator : public rer::client<cache_acq_validator> {
  public:
@@ -65,6 +70,11 @@ class cache_acq_validator : public rer::client<cache_acq_validator> {
                       const controller::cognitive::cache_sel_matrix* csel_matrix,
                       bool for_pickup);
 
+  /**
+   * \brief Validate against a snapshot of caches rather than a robot's DPO
+   * map. Lookups are linear in the # of caches, so this should only be used
+   * off of the per-robot/per-timestep paths.
+   */
   cache_acq_validator(const cads::bcache_vectorno& caches,
                       const controller::cognitive::cache_sel_matrix* csel_matrix,
                       bool for_pickup);
@@ -81,12 +91,19 @@ class cache_acq_validator : public rer::client<cache_acq_validator> {
                   const rtypes::timestep& t) const;
 
  private:
+  /**
+   * \brief Find the cache with the specified ID, returning \c nullptr if it is
+   * not known.
+   */
+  const carepr::base_cache* cache_find(const rtypes::type_uuid& id) const;
+
   bool pickup_policy_validate(const carepr::base_cache* cache,
                               const rtypes::timestep& t) const;
 
   /* clang-format off */
   const bool                                           mc_for_pickup;
   const controller::cognitive::cache_sel_matrix* const mc_csel_matrix;
+  const fspds::dp_cache_map* const                     mc_cache_map;
   const cads::bcache_vectorno                          mc_caches;
   /* clang-format on */
 };
@@ -28,6 +28,7 @@
 #include "cosm/spatial/fsm/acquire_goal_fsm.hpp"
 #include "cosm/subsystem/subsystem_fwd.hpp"
 
+#include "fordyca/controller/cognitive/d2/new_cache_selector.hpp"
 #include "fordyca/fsm/fsm_ro_params.hpp"
 #include "fordyca/subsystem/perception/perception_fwd.hpp"
 
@@ -77,6 +78,7 @@ class acquire_new_cache_fsm final : public rer::client<acquire_new_cache_fsm>,
   /* clang-format off */
   const controller::cognitive::cache_sel_matrix* const mc_matrix;
   const fspds::dpo_store*      const                   mc_store;
+  const controller::cognitive::d2::new_cache_selector  m_selector;
   /* clang-format on */
 };
 
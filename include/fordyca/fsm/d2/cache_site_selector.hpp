@@ -27,6 +27,7 @@
 #include <tuple>
 #include <functional>
 #include <vector>
+#include <memory>
 #include <string>
 #include <nlopt.hpp>
 #include <boost/optional.hpp>
@@ -38,6 +39,7 @@
 #include "rcppsw/types/spatial_dist.hpp"
 #include "rcppsw/math/rng.hpp"
 
+#include "fordyca/ds/spatial_hash.hpp"
 #include "fordyca/subsystem/perception/perception_fwd.hpp"
 
 /*******************************************************************************
@@ -65,13 +67,21 @@ NS_START(fsm, d2);
  * \brief Selects the best cache site between the location of the block pickup
  * and the nest (ideally the halfway point), subject to constraints such as it
  * can't be too near other known blocks, known caches, or the nest.
+ *
+ * Known caches are placed in a spatial index for each selection, and a single
+ * constraint which sums the proximity violations of all known caches near the
+ * point being evaluated is used, rather than one constraint per known cache,
+ * so that the cost of each constraint evaluation depends on the # of known
+ * caches near the point rather than on the total # of known caches.
  */
 class cache_site_selector: public rer::client<cache_site_selector> {
  public:
+  using cache_index_type = fds::spatial_hash<const carepr::base_cache*>;
+
   struct cache_constraint_data {
-    const carepr::base_cache* mc_cache{nullptr};
-    cache_site_selector*      selector{nullptr};
-    rtypes::spatial_dist      cache_prox{0.0};
+    const cache_index_type* caches{nullptr};
+    cache_site_selector*    selector{nullptr};
+    rtypes::spatial_dist    cache_prox{0.0};
   };
   struct nest_constraint_data {
     rmath::vector2d      nest_loc{};
@@ -149,8 +159,7 @@ class cache_site_selector: public rer::client<cache_site_selector> {
                                     nest_constraint_vector>;
 
   /**
-   * \brief Create constraints for known caches, known blocks, and relating to
-   * the nest.
+   * \brief Create constraints for known caches and relating to the nest.
    */
   void constraints_create(const cads::bcache_vectorno& known_caches,
                           const rmath::vector2d& nest_loc);
@@ -161,8 +170,7 @@ class cache_site_selector: public rer::client<cache_site_selector> {
                       std::vector<double>* initial_guess,
                       rmath::rng* rng);
 
-  bool verify_site(const rmath::vector2d& site,
-                   const cads::bcache_vectorno& known_caches) const RCPPSW_CONST;
+  bool verify_site(const rmath::vector2d& site) const;
 
   std::string nlopt_ret_str(nlopt::result res) const;
 
@@ -170,15 +178,34 @@ class cache_site_selector: public rer::client<cache_site_selector> {
   const controller::cognitive::cache_sel_matrix* const mc_matrix;
 
   nlopt::result   m_nlopt_res{};
-  nlopt::opt      m_alg{nlopt::algorithm::GN_ISRES, 2};
-  constraint_set  m_constraints{};
+  nlopt::opt                        m_alg{nlopt::algorithm::GN_ISRES, 2};
+  constraint_set                    m_constraints{};
+  std::unique_ptr<cache_index_type> m_cache_index{};
   /* clang-format on */
 };
 
+/**
+ * \brief Implements the cache nearness constraint for cache site selection:
+ * the distance to each known cache must be at least the cache proximity
+ * distance. Cannot be a member function because of how NLopt works,
+ * apparently.
+ */
 double __cache_constraint_func(const std::vector<double>& x,
                                std::vector<double>& ,
                                void *data) RCPPSW_PURE;
 
+/**
+ * \brief Compute the total amount by which \p point violates the cache
+ * proximity distance \p cache_prox with respect to the known caches in \p
+ * caches.
+ *
+ * \return The sum of (cache_prox - distance) over all known caches closer than
+ * \p cache_prox, or 0 if there are none.
+ */
+double cache_prox_violation(const cache_site_selector::cache_index_type& caches,
+                            const rmath::vector2d& point,
+                            const rtypes::spatial_dist& cache_prox) RCPPSW_PURE;
+
 /**
  * \brief Implements the nest nearness constraint for cache site selection, as
  * described in \todo paper ref. Cannot be a member function because of how
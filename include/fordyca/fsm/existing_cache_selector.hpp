@@ -23,10 +23,14 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include <vector>
+
 #include "rcppsw/er/client.hpp"
 #include "rcppsw/math/vector2.hpp"
 #include "rcppsw/types/timestep.hpp"
 
+#include "fordyca/fsm/cache_acq_validator.hpp"
+#include "fordyca/math/utility_batch.hpp"
 #include "fordyca/subsystem/perception/perception_fwd.hpp"
 
 /*******************************************************************************
@@ -75,7 +79,7 @@ class existing_cache_selector : public rer::client<existing_cache_selector> {
    */
   const carepr::base_cache* operator()(const fspds::dp_cache_map& existing_caches,
                                        const rmath::vector2d& position,
-                                       const rtypes::timestep& t);
+                                       const rtypes::timestep& t) const;
 
  private:
   /**
@@ -94,6 +98,14 @@ class existing_cache_selector : public rer::client<existing_cache_selector> {
   const bool                                           mc_is_pickup;
   const controller::cognitive::cache_sel_matrix* const mc_matrix;
   const fspds::dp_cache_map* const                     mc_cache_map;
+  const cache_acq_validator                            m_validator;
+
+  /**
+   * \brief Reused between selections, so that selection does not allocate once
+   * they have grown to hold all known caches.
+   */
+  mutable math::utility_batch                          m_batch{};
+  mutable std::vector<const carepr::base_cache*>       m_candidates{};
   /* clang-format on */
 };
 
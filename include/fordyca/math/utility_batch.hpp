@@ -0,0 +1,114 @@
+/**
+ * \file utility_batch.hpp
+ *
+ * \copyright 2022 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#pragma once
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <cstdint>
+#include <vector>
+#include <boost/optional.hpp>
+
+#include "rcppsw/math/vector2.hpp"
+
+#include "cosm/repr/pheromone_density.hpp"
+
+#include "fordyca/fordyca.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, math);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class utility_batch
+ * \ingroup math
+ *
+ * \brief Evaluates the \ref block_utility or \ref existing_cache_utility
+ * (\ref new_cache_utility) for a set of candidate objects at once.
+ *
+ * Candidates are stored as a structure of arrays, and all utilities are
+ * computed in a single branch-free loop which the compiler can vectorize,
+ * rather than constructing a utility expression for each candidate. Candidates
+ * which are not eligible for selection (e.g., on an exception list) are kept
+ * in the batch but masked out, so that candidate indices are stable and
+ * utilities of masked candidates are always 0.
+ */
+class utility_batch {
+ public:
+  utility_batch(void) = default;
+
+  /**
+   * \brief Clear all candidates, reserving space for \p n_candidates.
+   */
+  void reset(size_t n_candidates);
+
+  /**
+   * \brief Add a candidate to the batch.
+   *
+   * \param loc The location of the candidate.
+   * \param density The pheromone density of the candidate.
+   * \param weight The priority of the block type (block utility) or the # of
+   *               blocks in the cache (cache utility).
+   * \param eligible Should the candidate be considered for selection?
+   */
+  void add(const rmath::vector2d& loc,
+           const crepr::pheromone_density& density,
+           double weight,
+           bool eligible);
+
+  /**
+   * \brief Compute the \ref block_utility for all candidates.
+   */
+  void block_utilities_calc(const rmath::vector2d& rloc,
+                            const rmath::vector2d& nest_loc);
+
+  /**
+   * \brief Compute the \ref existing_cache_utility for all candidates.
+   */
+  void cache_utilities_calc(const rmath::vector2d& rloc,
+                            const rmath::vector2d& nest_loc);
+
+  /**
+   * \brief Get the index of the first candidate with the highest positive
+   * utility, if any; ties are resolved in favor of the candidate added first.
+   */
+  boost::optional<size_t> best(void) const;
+
+  double utility(size_t i) const { return m_utility[i]; }
+  size_t size(void) const { return m_x.size(); }
+  size_t n_eligible(void) const;
+
+ private:
+  /* clang-format off */
+  std::vector<double>  m_x{};
+  std::vector<double>  m_y{};
+  std::vector<double>  m_density{};
+  std::vector<double>  m_weight{};
+  std::vector<uint8_t> m_mask{};
+  std::vector<double>  m_utility{};
+  /* clang-format on */
+};
+
+NS_END(math, fordyca);
@@ -70,6 +70,13 @@ class dpo_metrics : public virtual rmetrics::base_metrics {
    * currently knows about.
    */
   virtual crepr::pheromone_density avg_cache_density(void) const = 0;
+
+  /**
+   * \brief Return \c TRUE if the robot verified that its LOS was correctly
+   * processed into its perception model this timestep, and \c FALSE
+   * otherwise.
+   */
+  virtual bool los_verified(void) const = 0;
 };
 
 NS_END(perception, metrics, fordyca);
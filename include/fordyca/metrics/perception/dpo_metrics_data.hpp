@@ -48,6 +48,7 @@ struct dpo_metrics_data {
   ral::mt_size_t  known_caches{0};
   ral::mt_double_t block_density_sum{0.0};
   ral::mt_double_t cache_density_sum{0.0};
+  ral::mt_size_t  los_verifications{0};
 };
 
 NS_END(detail);
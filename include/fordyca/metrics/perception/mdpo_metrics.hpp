@@ -72,6 +72,13 @@ class mdpo_metrics : public virtual rmetrics::base_metrics {
    * state, as a fraction of 1.0
    */
   virtual double unknown_percentage(void) const = 0;
+
+  /**
+   * \brief Return \c TRUE if the robot verified that its LOS was correctly
+   * processed into its perception model this timestep, and \c FALSE
+   * otherwise.
+   */
+  virtual bool los_verified(void) const = 0;
 };
 
 NS_END(perception, metrics, fordyca);
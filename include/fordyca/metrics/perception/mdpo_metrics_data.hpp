@@ -52,6 +52,7 @@ struct mdpo_metrics_data {
   ral::mt_double_t known_percent{0.0};
   ral::mt_double_t unknown_percent{0.0};
   ral::mt_size_t   robots{0};
+  ral::mt_size_t   los_verifications{0};
 };
 
 NS_END(detail);
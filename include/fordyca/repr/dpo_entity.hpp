@@ -47,6 +47,12 @@ NS_START(fordyca, repr);
  *
  * When performing equality tests between instances, only the underlying entity
  * is considered (relevance is ignored).
+ *
+ * The underlying entity is held by a reference counted handle, so that
+ * instances can share an immutable snapshot of the entity (see \ref
+ * dpo_snapshot_pool) rather than each owning a private clone. Shared entities
+ * are held as \c const \p T, so that \ref ent() cannot be used to modify
+ * them.
  */
 template <class T>
 class dpo_entity {
@@ -54,6 +60,8 @@ class dpo_entity {
   dpo_entity(void) = default;
   dpo_entity(std::unique_ptr<T> ent, const crepr::pheromone_density& density)
       : m_ent(std::move(ent)), m_density(density) {}
+  dpo_entity(std::shared_ptr<T> ent, const crepr::pheromone_density& density)
+      : m_ent(std::move(ent)), m_density(density) {}
 
   /**
    * \brief Compare two entities for equality. We must explicitly invoke
@@ -67,6 +75,11 @@ class dpo_entity {
   T* ent(void) { return m_ent.get(); }
   const T* ent(void) const { return m_ent.get(); }
 
+  /**
+   * \brief Get a (shared) handle to the underlying entity.
+   */
+  const std::shared_ptr<T>& snapshot(void) const { return m_ent; }
+
   const crepr::pheromone_density& density(void) const { return m_density; }
   crepr::pheromone_density& density(void) { return m_density; }
 
@@ -74,7 +87,7 @@ class dpo_entity {
 
  private:
   /* clang-format off */
-  std::unique_ptr<T>       m_ent;
+  std::shared_ptr<T>       m_ent;
   crepr::pheromone_density m_density;
   /* clang-format on */
 };
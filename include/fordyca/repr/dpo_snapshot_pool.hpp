@@ -0,0 +1,173 @@
+/**
+ * \file dpo_snapshot_pool.hpp
+ *
+ * \copyright 2022 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#pragma once
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include "rcppsw/types/type_uuid.hpp"
+
+#include "fordyca/fordyca.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, repr);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class dpo_snapshot_pool
+ * \ingroup repr
+ *
+ * \brief A swarm-wide pool of snapshots of arena entities, so that robots which
+ * see the same entity in the same state share a single clone of it in their
+ * \ref dpo_entity objects, rather than each robot making its own clone every
+ * time the entity is seen.
+ *
+ * Each snapshot is tagged with a version (e.g., the entity's location when the
+ * snapshot was taken); a new snapshot is only made when the version of the
+ * entity differs from that of the pooled snapshot. Robots holding a handle to
+ * an older snapshot keep it alive until they stop tracking it.
+ *
+ * The pool only holds weak references to its snapshots, so a snapshot is freed
+ * as soon as no robot is tracking it (e.g., the entity has moved or been
+ * consumed since). Pool entries for freed snapshots are pruned whenever the
+ * pool has doubled in size since the last pruning.
+ *
+ * Snapshots are shared, and therefore are immutable.
+ *
+ * Thread safe, as robots are updated in parallel.
+ */
+template <class T, class TVersionType>
+class dpo_snapshot_pool {
+ public:
+  using snapshot_type = std::shared_ptr<const T>;
+  using version_type = TVersionType;
+
+  /**
+   * \brief Get the pool for this type of entity.
+   */
+  static dpo_snapshot_pool& instance(void) {
+    static dpo_snapshot_pool pool;
+    return pool;
+  }
+
+  dpo_snapshot_pool(const dpo_snapshot_pool&) = delete;
+  dpo_snapshot_pool& operator=(const dpo_snapshot_pool&) = delete;
+
+  /**
+   * \brief Get a snapshot of the specified entity at the specified version,
+   * creating a new one if the pooled snapshot (if any) is out of date.
+   */
+  snapshot_type acquire(const T* ent, const version_type& version) {
+    {
+      std::shared_lock lock(m_mtx);
+      auto it = m_snapshots.find(ent->id());
+      if (it != m_snapshots.end() && it->second.version == version) {
+        if (auto snapshot = it->second.snapshot.lock()) {
+          return snapshot;
+        }
+      }
+    }
+    std::unique_lock lock(m_mtx);
+
+    /* another robot may have refreshed the snapshot while we waited */
+    auto& entry = m_snapshots[ent->id()];
+    auto snapshot = entry.snapshot.lock();
+    if (nullptr == snapshot || !(entry.version == version)) {
+      snapshot.reset(static_cast<T*>(ent->clone().release()));
+      entry.snapshot = snapshot;
+      entry.version = version;
+    }
+    expired_prune();
+    return snapshot;
+  }
+
+  /**
+   * \brief Release all pooled snapshots (e.g., on simulation reset). Snapshots
+   * still held by robots are unaffected.
+   */
+  void clear(void) {
+    std::unique_lock lock(m_mtx);
+    m_snapshots.clear();
+    m_prune_size = kMIN_PRUNE_SIZE;
+  }
+
+  size_t size(void) const {
+    std::shared_lock lock(m_mtx);
+    return m_snapshots.size();
+  }
+
+ private:
+  /**
+   * \brief The minimum # of pool entries before entries for freed snapshots
+   * are pruned.
+   */
+  static constexpr size_t kMIN_PRUNE_SIZE = 1024;
+
+  struct entry_type {
+    version_type           version{};
+    std::weak_ptr<const T> snapshot{};
+  };
+
+  struct id_hash {
+    size_t operator()(const rtypes::type_uuid& id) const {
+      return std::hash<int>()(id.v());
+    }
+  };
+
+  dpo_snapshot_pool(void) = default;
+
+  /**
+   * \brief Remove the entries for snapshots no robot is tracking anymore, if
+   * the pool has grown enough since the last time this was done that doing so
+   * is amortized constant time. Must be called with the pool locked.
+   */
+  void expired_prune(void) {
+    if (m_snapshots.size() < m_prune_size) {
+      return;
+    }
+    for (auto it = m_snapshots.begin(); it != m_snapshots.end();) {
+      if (it->second.snapshot.expired()) {
+        it = m_snapshots.erase(it);
+      } else {
+        ++it;
+      }
+    } /* for(it..) */
+    m_prune_size = std::max(kMIN_PRUNE_SIZE, 2 * m_snapshots.size());
+  }
+
+  /* clang-format off */
+  mutable std::shared_mutex                                m_mtx{};
+  std::unordered_map<rtypes::type_uuid, entry_type, id_hash> m_snapshots{};
+  size_t                                                   m_prune_size{kMIN_PRUNE_SIZE};
+  /* clang-format on */
+};
+
+NS_END(repr, fordyca);
@@ -40,7 +40,9 @@ NS_START(fordyca, repr);
  * \ingroup repr
  *
  * \brief A line of sight for foraging applications, which computes the lists of
- * blocks and/or caches present in the LOS on request.
+ * blocks and/or caches present in the LOS once upon construction (the LOS is
+ * recreated every timestep, and the arena cells it refers to do not change
+ * between its creation and its use by the robot's perception subsystem).
  *
  * The line of sight itself is meant to be a read-only view of part of the
  * arena, but it also exposes non-const access to the blocks and caches within
@@ -54,10 +56,26 @@ class forager_los final : public crepr::grid2D_los,
               const rtypes::discretize_ratio& c_resolution);
 
   /**
-   * \brief Get the list of blocks currently in the LOS.
+   * \brief Get the list of (unique) blocks currently in the LOS.
    */
-  cds::block3D_vectorno blocks(void) const;
-  cads::bcache_vectorno caches(void) const;
+  const cds::block3D_vectorno& blocks(void) const { return m_blocks; }
+
+  /**
+   * \brief Get the list of (unique) caches currently in the LOS.
+   */
+  const cads::bcache_vectorno& caches(void) const { return m_caches; }
+
+ private:
+  /**
+   * \brief Scan all cells in the LOS and populate the lists of blocks and
+   * caches.
+   */
+  void objects_extract(void);
+
+  /* clang-format off */
+  cds::block3D_vectorno m_blocks{};
+  cads::bcache_vectorno m_caches{};
+  /* clang-format on */
 };
 
 NS_END(repr, fordyca);
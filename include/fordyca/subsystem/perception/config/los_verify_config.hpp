@@ -0,0 +1,65 @@
+/**
+ * \file los_verify_config.hpp
+ *
+ * \copyright 2022 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#pragma once
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <string>
+
+#include "rcppsw/config/base_config.hpp"
+
+#include "fordyca/fordyca.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, subsystem, perception, config);
+
+/*******************************************************************************
+ * Structure Definitions
+ ******************************************************************************/
+/**
+ * \struct los_verify_config
+ * \ingroup subsystem perception config
+ *
+ * \brief Configuration for how often robots verify that their LOS has been
+ * correctly processed into their perception model (see \ref los_proc_verify).
+ */
+struct los_verify_config final : public rconfig::base_config {
+  /**
+   * \brief One of [always, interval, sampled, off].
+   */
+  std::string policy{"always"};
+
+  /**
+   * \brief For the \c interval policy, verify every this many timesteps.
+   */
+  size_t interval{1};
+
+  /**
+   * \brief For the \c sampled policy, each robot has a 1 in this many chance of
+   * being selected to verify every timestep.
+   */
+  size_t robot_ratio{1};
+};
+
+NS_END(config, perception, subsystem, fordyca);
@@ -0,0 +1,76 @@
+/**
+ * \file los_verify_parser.hpp
+ *
+ * \copyright 2022 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#pragma once
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <string>
+#include <memory>
+
+#include "rcppsw/config/xml/xml_config_parser.hpp"
+
+#include "fordyca/subsystem/perception/config/los_verify_config.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, subsystem, perception, config);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class los_verify_parser
+ * \ingroup subsystem perception config
+ *
+ * \brief Parses XML parameters for \ref los_verify_config at the start of
+ * simulation.
+ */
+class los_verify_parser : public rer::client<los_verify_parser>,
+                          public rconfig::xml::xml_config_parser {
+ public:
+  using config_type = los_verify_config;
+
+  los_verify_parser(void)
+      : ER_CLIENT_INIT("fordyca.subsystem.perception.config.los_verify_parser") {}
+
+  /**
+   * \brief The root tag that all LOS verification parameters should lie under
+   * in the XML tree.
+   */
+  inline static const std::string kXMLRoot = "los_verify";
+
+  bool validate(void) const override RCPPSW_ATTR(pure, cold);
+  void parse(const ticpp::Element& node) override RCPPSW_COLD;
+  std::string xml_root(void) const override { return kXMLRoot; }
+
+ private:
+  const rconfig::base_config* config_get_impl(void) const override {
+    return m_config.get();
+  }
+
+  /* clang-format off */
+  std::unique_ptr<config_type> m_config{nullptr};
+  /* clang-format on */
+};
+
+NS_END(config, perception, subsystem, fordyca);
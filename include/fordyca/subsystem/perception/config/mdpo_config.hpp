@@ -46,6 +46,22 @@ NS_START(fordyca, subsystem, perception, config);
 struct mdpo_config final : public rconfig::base_config {
   cspconfig::pheromone_config pheromone {};
   cspconfig::rlos_config rlos {};
+
+  /**
+   * \brief If \c TRUE, then the pheromone density of each cell in the
+   * occupancy grid is only brought up to date when it is accessed, rather than
+   * decaying every cell in the grid every timestep. Cells still transition
+   * back to UNKNOWN on the same timestep as they would with eager decay.
+   */
+  bool lazy_decay{false};
+
+  /**
+   * \brief If > 0, then the occupancy grid is divided into square tiles of
+   * this many cells per side, which are only allocated once a cell within them
+   * is accessed, and are freed once all of their cells have decayed back to
+   * UNKNOWN. If 0, then the whole grid is allocated up front.
+   */
+  size_t tile_size{0};
 };
 
 NS_END(config, perception, subsystem, fordyca);
@@ -30,6 +30,7 @@
 #include "cosm/subsystem/perception/config/rlos_config.hpp"
 
 #include "fordyca/subsystem/perception/config/dpo_config.hpp"
+#include "fordyca/subsystem/perception/config/los_verify_config.hpp"
 #include "fordyca/subsystem/perception/config/mdpo_config.hpp"
 
 /*******************************************************************************
@@ -51,6 +52,7 @@ struct perception_config final : public rconfig::base_config {
 
   dpo_config dpo {};
   mdpo_config mdpo {};
+  los_verify_config los_verify {};
 };
 
 NS_END(config, perception, subsystem, fordyca);
@@ -30,6 +30,7 @@
 
 #include "fordyca/subsystem/perception/config/perception_config.hpp"
 #include "fordyca/subsystem/perception/config/dpo_parser.hpp"
+#include "fordyca/subsystem/perception/config/los_verify_parser.hpp"
 #include "fordyca/subsystem/perception/config/mdpo_parser.hpp"
 
 /*******************************************************************************
@@ -75,6 +76,7 @@ class perception_parser final : public rer::client<perception_parser>,
   std::unique_ptr<config_type> m_config{nullptr};
   dpo_parser                   m_dpo{};
   mdpo_parser                  m_mdpo{};
+  los_verify_parser            m_los_verify{};
   /* clang-format on */
 };
 
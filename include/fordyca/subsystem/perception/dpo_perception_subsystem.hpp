@@ -32,6 +32,7 @@
 
 #include "fordyca/subsystem/perception/config/perception_config.hpp"
 #include "fordyca/subsystem/perception/foraging_perception_subsystem.hpp"
+#include "fordyca/subsystem/perception/los_verify_policy.hpp"
 #include "fordyca/fordyca.hpp"
 #include "fordyca/metrics/perception/dpo_metrics.hpp"
 #include "fordyca/subsystem/perception/perception_fwd.hpp"
@@ -56,7 +57,8 @@ class dpo_perception_subsystem final
       public foraging_perception_subsystem,
       public metrics::perception::dpo_metrics {
  public:
-  explicit dpo_perception_subsystem(const config::perception_config* config);
+  dpo_perception_subsystem(const config::perception_config* config,
+                           rmath::rng* rng);
   ~dpo_perception_subsystem(void) override;
 
   /* DPO perception metrics */
@@ -64,6 +66,7 @@ class dpo_perception_subsystem final
   size_t n_known_caches(void) const override RCPPSW_PURE;
   crepr::pheromone_density avg_block_density(void) const override;
   crepr::pheromone_density avg_cache_density(void) const override;
+  bool los_verified(void) const override RCPPSW_PURE;
 
   /* foraging_perception_subsystem overrides */
   const known_objects_accessor* known_objects(void) const override RCPPSW_PURE;
@@ -95,6 +98,10 @@ class dpo_perception_subsystem final
 
   const ds::dpo_store* store(void) const RCPPSW_PURE;
   ds::dpo_store* store(void) RCPPSW_PURE;
+
+  /* clang-format off */
+  los_verify_policy m_verify;
+  /* clang-format on */
 };
 
 NS_END(cognitive, controller, fordyca);
@@ -25,6 +25,7 @@
  ******************************************************************************/
 #include <string>
 
+#include "rcppsw/math/vector2.hpp"
 #include "rcppsw/types/type_uuid.hpp"
 #include "rcppsw/er/stringizable.hpp"
 
@@ -49,18 +50,27 @@ NS_START(fordyca, subsystem, perception, ds);
  * in the arena. It uses integers as keys, because blocks are mobile (i.e. can
  * move between instants of time where the robot sees them), and
  * inserting/removing blocks from the map using location comparison will not
- * give correct results.
+ * give correct results. Blocks are also indexed by their discrete anchor, so
+ * that the block (if any) tracked at a given location can be found quickly.
+ *
+ * Tracked blocks are snapshots shared with other robots (see \ref
+ * repr::dpo_snapshot_pool), and so are immutable.
  */
 class dp_block_map : public dpo_map<rtypes::type_uuid,
-                                    crepr::sim_block3D>,
+                                    rmath::vector2z,
+                                    const crepr::sim_block3D>,
                      public rer::stringizable {
  public:
   using dpo_map<rtypes::type_uuid,
-                crepr::sim_block3D>::dpo_map;
+                rmath::vector2z,
+                const crepr::sim_block3D>::dpo_map;
   ~dp_block_map(void) override = default;
 
 
   std::string to_str(void) const override;
+
+ protected:
+  rmath::vector2z alt_key(const value_type& v) const override;
 };
 
 NS_END(ds, perception, subsystem, fordyca);
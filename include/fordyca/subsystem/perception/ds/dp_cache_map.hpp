@@ -26,6 +26,7 @@
 #include <string>
 
 #include "rcppsw/math/vector2.hpp"
+#include "rcppsw/types/type_uuid.hpp"
 #include "rcppsw/er/stringizable.hpp"
 
 #include "fordyca/subsystem/perception/ds/dpo_map.hpp"
@@ -54,15 +55,23 @@ NS_START(fordyca, subsystem, perception, ds);
  * depleted would not be replaced with a newer version of that cache with ID 1
  * during LOS process (it would be inserted into the map, but the old version
  * would not be removed, as they would be considered different objects).
+ *
+ * Caches are also indexed by ID, so that removal of a specific cache is
+ * constant time.
  */
 class dp_cache_map : public dpo_map<rmath::vector2z,
+                                    rtypes::type_uuid,
                                     carepr::base_cache>,
                      public rer::stringizable {
  public:
   using dpo_map<rmath::vector2z,
+                rtypes::type_uuid,
                 carepr::base_cache>::dpo_map;
 
   std::string to_str(void) const override;
+
+ protected:
+  rtypes::type_uuid alt_key(const value_type& v) const override;
 };
 
 NS_END(ds, perception, subsystem, fordyca);
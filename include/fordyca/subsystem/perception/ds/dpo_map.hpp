@@ -24,10 +24,16 @@
  * Includes
  ******************************************************************************/
 #include <boost/range/adaptor/map.hpp>
+#include <boost/range/adaptor/transformed.hpp>
 #include <boost/range/algorithm.hpp>
-#include <map>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
 #include <utility>
 
+#include "rcppsw/math/vector2.hpp"
+#include "rcppsw/types/type_uuid.hpp"
+
 #include "fordyca/repr/dpo_entity.hpp"
 
 /*******************************************************************************
@@ -35,6 +41,43 @@
  ******************************************************************************/
 NS_START(fordyca, subsystem, perception, ds);
 
+/*******************************************************************************
+ * Struct Definitions
+ ******************************************************************************/
+/**
+ * \struct dpo_key_hash
+ * \ingroup subsystem perception ds
+ *
+ * \brief Hash function for the types of keys used to index objects in \ref
+ * dpo_map (object IDs and discrete locations).
+ */
+struct dpo_key_hash {
+  size_t operator()(const rtypes::type_uuid& id) const {
+    return std::hash<int>()(id.v());
+  }
+  size_t operator()(const rmath::vector2z& loc) const {
+    /*
+     * Pack both coordinates into a single key, so that distinct locations
+     * within the arena never collide (XORing the hashes of the coordinates
+     * collides a lot for small coordinates).
+     */
+    return std::hash<uint64_t>()((static_cast<uint64_t>(loc.x()) << 32) |
+                                 static_cast<uint32_t>(loc.y()));
+  }
+};
+
+/**
+ * \struct dpo_ent_extract
+ * \ingroup subsystem perception ds
+ *
+ * \brief Extract the raw object from a \ref repr::dpo_entity, for use in range
+ * adaptors.
+ */
+struct dpo_ent_extract {
+  template <typename T>
+  T* operator()(repr::dpo_entity<T>& v) const { return v.ent(); }
+};
+
 /*******************************************************************************
  * Class Definitions
  ******************************************************************************/
@@ -46,20 +89,28 @@ NS_START(fordyca, subsystem, perception, ds);
  * SEPARATELY from the \ref arena_map where they actually live (clone not
  * reference), which decouples/simplifies a lot of the tricky handshaking logic
  * when robots interact with the arena.
+ *
+ * Objects are stored in a hash map by their primary key, and are additionally
+ * indexed by a secondary key (e.g., location for blocks, ID for caches) so that
+ * lookups by either key are constant time.
  */
 template <typename TKeyType,
+          typename TAltKeyType,
           typename TRawValueType>
 class dpo_map {
  public:
   using raw_value_type = TRawValueType;
   using value_type = typename repr::dpo_entity<TRawValueType>;
   using key_type = TKeyType;
-  using map_type = std::map<key_type, value_type>;
+  using alt_key_type = TAltKeyType;
+  using map_type = std::unordered_map<key_type, value_type, dpo_key_hash>;
+  using alt_map_type = std::unordered_map<alt_key_type, key_type, dpo_key_hash>;
 
   template<typename TRawVectorType>
   static TRawVectorType raw_values_extract(const dpo_map& map) {
     auto range = map.values_range();
     TRawVectorType ret;
+    ret.reserve(map.size());
     boost::range::for_each(range, [&](value_type& v) { ret.push_back(v.ent()); });
     return ret;
   }
@@ -90,6 +141,19 @@ class dpo_map {
     return (it == m_obj.end()) ? nullptr : &(it->second);
   }
 
+  /**
+   * \brief Returns a pointer to the object that matches the specified secondary
+   * key, or nullptr if no such object is in the map.
+   */
+  const value_type* alt_find(const alt_key_type& alt) const RCPPSW_PURE {
+    auto it = m_alt.find(alt);
+    return (it == m_alt.end()) ? nullptr : find(it->second);
+  }
+  value_type* alt_find(const alt_key_type& alt) RCPPSW_PURE {
+    auto it = m_alt.find(alt);
+    return (it == m_alt.end()) ? nullptr : find(it->second);
+  }
+
   /**
    * \brief Returns \c TRUE iff the key is contained in the map, and \c FALSE
    * otherwise.
@@ -104,7 +168,8 @@ class dpo_map {
    * version is replaced.
    */
   void obj_add(std::pair<key_type, value_type>&& obj) {
-    m_obj.erase(obj.first);
+    obj_remove(obj.first);
+    m_alt[alt_key(obj.second)] = obj.first;
     m_obj.insert(std::move(obj));
   }
 
@@ -120,6 +185,15 @@ class dpo_map {
     return m_obj | boost::adaptors::map_values;
   }
 
+  /**
+   * \brief Return an iterator over the raw objects in the map (i.e., without
+   * tracking information). Unlike \ref raw_values_extract(), nothing is
+   * copied.
+   */
+  auto raw_values_range(void) const {
+    return values_range() | boost::adaptors::transformed(dpo_ent_extract());
+  }
+
   /**
    * \brief Return an iterator for examining, but not modifying, the keys of
    * the map.
@@ -133,18 +207,43 @@ class dpo_map {
    * type (if it exists). If the argument is not in the map of known objects of
    * that type, no action is performed.
    */
-  void obj_remove(const key_type& key) { m_obj.erase(key); }
+  void obj_remove(const key_type& key) {
+    auto it = m_obj.find(key);
+    if (it == m_obj.end()) {
+      return;
+    }
+    /*
+     * Only remove the secondary index entry if it still refers to the object
+     * being removed, as another object with the same secondary key may have
+     * been added since.
+     */
+    auto alt_it = m_alt.find(alt_key(it->second));
+    if (alt_it != m_alt.end() && alt_it->second == key) {
+      m_alt.erase(alt_it);
+    }
+    m_obj.erase(it);
+  }
+
+  void clear(void) {
+    m_obj.clear();
+    m_alt.clear();
+  }
+
+ protected:
+  /**
+   * \brief Compute the secondary key for an object in the map.
+   */
+  virtual alt_key_type alt_key(const value_type& v) const = 0;
 
  private:
   /* clang-format off */
   map_type        m_obj{};
+  alt_map_type    m_alt{};
   /* clang-format on */
 
  public:
   RCPPSW_WRAP_DECLDEF(size, m_obj, const)
   RCPPSW_WRAP_DECLDEF(empty, m_obj, const)
-  RCPPSW_WRAP_DECLDEF(clear, m_obj)
 };
 
 NS_END(ds, perception, subsystem, fordyca);
-
@@ -73,17 +73,20 @@ class dpo_semantic_map final : public rer::client<dpo_semantic_map>,
   /* access_known_blocks overrides */
   RCPPSW_WRAP_DECLDEF_OVERRIDE(known_blocks, (*store()), const);
   RCPPSW_WRAP_DECLDEF_OVERRIDE(known_caches, (*store()), const)
+  RCPPSW_WRAP_DECLDEF_OVERRIDE(known_blocks_range, (*store()), const)
+  RCPPSW_WRAP_DECLDEF_OVERRIDE(known_caches_range, (*store()), const)
+  RCPPSW_WRAP_DECLDEF_OVERRIDE(n_known_blocks, (*store()), const)
+  RCPPSW_WRAP_DECLDEF_OVERRIDE(n_known_caches, (*store()), const)
 
   /* foraging_memory_model overrides */
   bool cache_remove(carepr::base_cache* victim) override;
-  bool block_remove(crepr::sim_block3D* victim) override;
+  bool block_remove(const crepr::sim_block3D* victim) override;
   model_update_result block_update(tracked_block_type&& block) override;
   model_update_result cache_update(tracked_cache_type&& cache) override;
 
   /**
    * \brief Access a particular element in the discretized grid representing the
-   * robot's view of the arena. No bounds checking is performed, so if something
-   * is out of bounds, boost will fail with a bounds checking assertion.
+   * robot's view of the arena. No bounds checking is performed.
    *
    * \param i X coord.
    * \param j Y coord
@@ -91,22 +94,19 @@ class dpo_semantic_map final : public rer::client<dpo_semantic_map>,
    * \return The cell.
    */
   template <size_t Index>
-  typename occupancy_grid::layer_value_type<Index>::value_type& access(size_t i,
-                                                                       size_t j) {
+  occupancy_grid::layer_type<Index>& access(size_t i, size_t j) {
     return decoratee().access<Index>(i, j);
   }
   template <size_t Index>
-  const typename occupancy_grid::layer_value_type<Index>::value_type&
-  access(size_t i, size_t j) const {
+  const occupancy_grid::layer_type<Index>& access(size_t i, size_t j) const {
     return decoratee().access<Index>(i, j);
   }
   template <size_t Index>
-  typename occupancy_grid::layer_value_type<Index>::value_type&
-  access(const rmath::vector2z& d) {
+  occupancy_grid::layer_type<Index>& access(const rmath::vector2z& d) {
     return decoratee().access<Index>(d);
   }
   template <size_t Index>
-  const typename occupancy_grid::layer_value_type<Index>::value_type&
+  const occupancy_grid::layer_type<Index>&
   access(const rmath::vector2z& d) const {
     return decoratee().access<Index>(d);
   }
@@ -133,6 +133,7 @@ class dpo_semantic_map final : public rer::client<dpo_semantic_map>,
   RCPPSW_DECORATE_DECLDEF(resolution, const)
 
   RCPPSW_DECORATE_DECLDEF(pheromone_repeat_deposit, const);
+  RCPPSW_DECORATE_DECLDEF(pheromone);
 
  private:
   /* clang-format off */
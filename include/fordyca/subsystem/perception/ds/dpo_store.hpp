@@ -74,16 +74,24 @@ class dpo_store final : public foraging_memory_model<ds::dp_block_map,
   explicit dpo_store(const cspconfig::pheromone_config* config);
 
   /* access_known_objects overrides */
-  cds::block3D_vectorno known_blocks(void) const override {
-    return dp_block_map::raw_values_extract<cds::block3D_vectorno>(tracked_blocks());
+  cds::block3D_vectorro known_blocks(void) const override {
+    return dp_block_map::raw_values_extract<cds::block3D_vectorro>(tracked_blocks());
   }
   cads::bcache_vectorno known_caches(void) const override {
     return dp_cache_map::raw_values_extract<cads::bcache_vectorno>(tracked_caches());
   }
+  known_blocks_range_type known_blocks_range(void) const override {
+    return tracked_blocks().raw_values_range();
+  }
+  known_caches_range_type known_caches_range(void) const override {
+    return tracked_caches().raw_values_range();
+  }
+  size_t n_known_blocks(void) const override { return tracked_blocks().size(); }
+  size_t n_known_caches(void) const override { return tracked_caches().size(); }
 
   /* foraging_memory_model overrides */
   bool cache_remove(carepr::base_cache* victim) override;
-  bool block_remove(crepr::sim_block3D* victim) override;
+  bool block_remove(const crepr::sim_block3D* victim) override;
   model_update_result cache_update(tracked_cache_type&& cache) override;
 
   /*
@@ -109,6 +117,16 @@ class dpo_store final : public foraging_memory_model<ds::dp_block_map,
 
   double pheromone_rho(void) const { return mc_pheromone_rho; }
 
+  /**
+   * \brief Compute the average pheromone density of all tracked blocks.
+   */
+  crepr::pheromone_density avg_block_density(void) const;
+
+  /**
+   * \brief Compute the average pheromone density of all tracked caches.
+   */
+  crepr::pheromone_density avg_cache_density(void) const;
+
  private:
   /* clang-format off */
   const bool   mc_repeat_deposit;
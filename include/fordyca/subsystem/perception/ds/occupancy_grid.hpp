@@ -23,11 +23,18 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <queue>
 #include <string>
 #include <tuple>
+#include <vector>
 
-#include "rcppsw/ds/stacked_grid2D.hpp"
+#include "rcppsw/er/client.hpp"
 #include "rcppsw/math/vector2.hpp"
+#include "rcppsw/types/discretize_ratio.hpp"
 
 #include "cosm/ds/cell2D.hpp"
 #include "cosm/repr/pheromone_density.hpp"
@@ -55,9 +62,19 @@ using robot_layer_stack = std::tuple<crepr::pheromone_density, cds::cell2D>;
  * \brief Multilayered grid of cells and associated information
  * density/relevance on the state of those cells. Used by robots in making
  * decisions in how they execute their tasks.
+ *
+ * The grid is stored as a set of square tiles. By default there is a single
+ * tile covering the whole grid, which is allocated up front. If tiling is
+ * enabled, tiles are allocated the first time a cell within them is accessed,
+ * and freed once none of their cells have any density or contain a known
+ * object (i.e., all cells are UNKNOWN or EMPTY), so that the memory used by
+ * each robot scales with how much of the arena it currently knows about,
+ * rather than with the size of the arena. Freed EMPTY cells revert to
+ * UNKNOWN. Tiles which have had a cell density accessed via \ref pheromone()
+ * since the last update are not freed, so tiles within a robot's LOS are not
+ * repeatedly freed and reallocated.
  */
-class occupancy_grid : public rer::client<occupancy_grid>,
-                       public rds::stacked_grid2D<robot_layer_stack> {
+class occupancy_grid : public rer::client<occupancy_grid> {
  public:
   /**
    * \brief The index of the \ref crepr::pheromone_density layer.
@@ -69,18 +86,80 @@ class occupancy_grid : public rer::client<occupancy_grid>,
    */
   static constexpr size_t kCell = 1;
 
+  template <size_t Index>
+  using layer_type = typename std::tuple_element<Index, robot_layer_stack>::type;
+
   explicit occupancy_grid(const config::mdpo_config* c_config);
 
   /**
    * \brief Update the density of all cells in the grid.
+   *
+   * Only cells which have been given a non-zero density since they were last
+   * reset are decayed; the decay pass only touches the pheromone layer, and
+   * cells whose density drops below \ref kEPSILON are collected and have their
+   * state updated in a second pass over just those cells.
+   *
+   * If lazy decay is enabled, only cells whose density has dropped below \ref
+   * kEPSILON as of this timestep are visited; all other cells are brought up to
+   * date on their next access via \ref pheromone().
+   *
+   * If tiling is enabled, tiles which have become freeable are freed.
    */
   void update(void);
 
   /**
-   * \brief Reset all the cells in the grid
+   * \brief Access a particular element in the grid. If tiling is enabled and
+   * the tile containing the element has not been allocated yet, it is
+   * allocated, with all of its cells UNKNOWN. No bounds checking is performed.
+   *
+   * References are only valid until the next call to \ref update(), which may
+   * free tiles.
+   */
+  template <size_t Index>
+  layer_type<Index>& access(size_t i, size_t j) {
+    return layer_access<Index>(tile_get(i, j), i, j);
+  }
+  template <size_t Index>
+  const layer_type<Index>& access(size_t i, size_t j) const {
+    return layer_access<Index>(tile_get(i, j), i, j);
+  }
+  template <size_t Index>
+  layer_type<Index>& access(const rmath::vector2z& d) {
+    return access<Index>(d.x(), d.y());
+  }
+  template <size_t Index>
+  const layer_type<Index>& access(const rmath::vector2z& d) const {
+    return access<Index>(d.x(), d.y());
+  }
+
+  /**
+   * \brief Access the pheromone density of a cell in the grid. All density
+   * reads/writes should go through this function rather than \c
+   * access<kPheromone>(), so that lazily decayed cells are brought up to date
+   * before use and (re)scheduled for expiry after any modification.
+   */
+  crepr::pheromone_density& pheromone(size_t i, size_t j);
+  crepr::pheromone_density& pheromone(const rmath::vector2z& d) {
+    return pheromone(d.x(), d.y());
+  }
+
+  bool lazy_decay(void) const { return mc_lazy_decay; }
+  bool tiled(void) const { return mc_tiled; }
+
+  /**
+   * \brief Reset all the cells in the grid, along with all decay bookkeeping.
+   * If tiling is enabled, all tiles are freed.
    */
   void reset(void);
 
+  size_t xdsize(void) const { return m_xdsize; }
+  size_t ydsize(void) const { return m_ydsize; }
+  double xrsize(void) const { return m_xdsize * mc_resolution.v(); }
+  double yrsize(void) const { return m_ydsize * mc_resolution.v(); }
+  const rtypes::discretize_ratio& resolution(void) const {
+    return mc_resolution;
+  }
+
   bool pheromone_repeat_deposit(void) const { return m_pheromone_repeat_deposit; }
 
   size_t known_cell_count(void) const { return m_known_cell_count; }
@@ -88,6 +167,139 @@ class occupancy_grid : public rer::client<occupancy_grid>,
   void known_cells_dec(void) { --m_known_cell_count; }
 
  private:
+  static constexpr size_t kNEVER = std::numeric_limits<size_t>::max();
+  static constexpr size_t kLIVE_WORD_BITS = 64;
+
+  /**
+   * \brief The # of updates after which a tile which has not had a cell density
+   * accessed is considered idle, and is checked for release.
+   */
+  static constexpr size_t kTILE_IDLE_UPDATES = 2;
+
+  /**
+   * \brief Per-cell bookkeeping for lazy pheromone decay.
+   */
+  struct lazy_cell_info {
+    /**
+     * \brief The timestep the density of the cell was last brought up to
+     * date.
+     */
+    size_t touched{kNEVER};
+
+    /**
+     * \brief The timestep the cell is currently scheduled to expire, used to
+     * discard stale entries in the expiry queue.
+     */
+    size_t expiry{kNEVER};
+  };
+
+  /**
+   * \brief A rectangular block of cells, stored in row-major order by layer.
+   */
+  struct tile {
+    std::vector<crepr::pheromone_density> pheromone{};
+    std::vector<cds::cell2D>              cells{};
+
+    /**
+     * \brief Lazy decay only.
+     */
+    std::vector<lazy_cell_info>           lazy{};
+
+    /**
+     * \brief Lazy decay only: the # of cells with a pending expiry.
+     */
+    size_t                                n_scheduled{0};
+
+    /**
+     * \brief Eager decay only: bitset of cells which may have non-zero density,
+     * so that decay can skip over the (usually large) unknown regions of the
+     * grid 64 cells at a time.
+     */
+    std::vector<uint64_t>                 live{};
+
+    /**
+     * \brief Tiling only: the # of updates since a cell density in the tile
+     * was accessed, saturating at \ref kTILE_IDLE_UPDATES.
+     */
+    size_t                                idle{0};
+  };
+
+  /**
+   * \brief (expiry timestep, i, j), ordered soonest first.
+   */
+  using expiry_entry = std::tuple<size_t, size_t, size_t>;
+  using expiry_queue = std::priority_queue<expiry_entry,
+                                           std::vector<expiry_entry>,
+                                           std::greater<expiry_entry>>;
+
+  template <size_t Index>
+  static layer_type<Index>& layer_access(tile* t, size_t index) {
+    if constexpr (kPheromone == Index) {
+      return t->pheromone[index];
+    } else {
+      return t->cells[index];
+    }
+  }
+  template <size_t Index>
+  layer_type<Index>& layer_access(tile* t, size_t i, size_t j) const {
+    return layer_access<Index>(t, cell_index(i, j));
+  }
+
+  size_t tile_index(size_t i, size_t j) const {
+    return mc_tiled ? (i / m_tile_xdim) * m_n_ytiles + j / m_tile_ydim : 0;
+  }
+
+  /**
+   * \brief Index of cell (i,j) within its tile.
+   */
+  size_t cell_index(size_t i, size_t j) const {
+    return mc_tiled ? (i % m_tile_xdim) * m_tile_ydim + j % m_tile_ydim
+                    : i * m_tile_ydim + j;
+  }
+
+  /**
+   * \brief Get the tile containing cell (i,j), allocating it if needed.
+   */
+  tile* tile_get(size_t i, size_t j) const;
+
+  /**
+   * \brief Get the tile containing cell (i,j), or NULL if it is not allocated.
+   */
+  tile* tile_find(size_t i, size_t j) const {
+    return m_tiles[tile_index(i, j)].get();
+  }
+
+  /**
+   * \brief Free the tile containing cell (i,j) if tiling is enabled, the tile
+   * is idle, and none of its cells have any density or contain a known object.
+   */
+  void tile_release_check(size_t i, size_t j);
+
+  /**
+   * \brief Advance the idle count of all tiles, and check the ones which have
+   * just become idle for release.
+   */
+  void tiles_idle_update(void);
+
+  /**
+   * \brief Mark cell (i,j) as possibly having non-zero density, so that it is
+   * visited during eager decay.
+   */
+  void live_mark(tile* t, size_t i, size_t j) {
+    size_t index = cell_index(i, j);
+    t->live[index / kLIVE_WORD_BITS] |= (uint64_t{1} << (index % kLIVE_WORD_BITS));
+  }
+  void live_clear(tile* t, size_t i, size_t j) {
+    size_t index = cell_index(i, j);
+    t->live[index / kLIVE_WORD_BITS] &= ~(uint64_t{1} << (index % kLIVE_WORD_BITS));
+  }
+
+  /**
+   * \brief Decay all live cells in a tile, collecting the ones which need their
+   * state updated.
+   */
+  void tile_decay(tile* t, size_t xoffset, size_t yoffset);
+
   /**
    * \brief Update the state of cell (i,j), which involves decreasing its
    * pheromone density, and possibly reseting the cell to be empty if its
@@ -96,27 +308,58 @@ class occupancy_grid : public rer::client<occupancy_grid>,
   void cell_state_update(size_t i, size_t j);
 
   /**
-   * \brief Initialize a cell in the occupancy grid, which sets the rate of
-   * pheromone decay for the cell, the cell's own reference to its
-   * location. Needed because the underlying boost data structure does not
-   * support non zero parameter constructors, and we do *NOT* want to use
-   * pointers to cells, because that kills our memory performance.
+   * \brief Bring the density of cell (i,j) up to the current timestep in closed
+   * form, using the timestep it was last touched.
+   */
+  crepr::pheromone_density& lazy_materialize(size_t i, size_t j);
+
+  /**
+   * \brief Compute the timestep at which the (current) density of cell (i,j)
+   * will drop below \ref kEPSILON, and schedule the cell to be visited then.
+   */
+  void lazy_expiry_schedule(size_t i, size_t j);
+
+  /**
+   * \brief Set the expiry of cell (i,j), keeping the # of cells with pending
+   * expiries in its tile up to date.
    */
-  void cell_init(size_t i, size_t j, double pheromone_rho);
+  void lazy_expiry_set(tile* t, size_t i, size_t j, size_t expiry);
 
   /* clang-format off */
+
   /**
    * \brief The threshold for a cell's pheromone density at which it will
    * transition into back an UNKNOWN state, from whatever state it is currently
    * in.
    */
 
-  static constexpr double             kEPSILON{0.0001};
+  static constexpr double                   kEPSILON{0.0001};
+
+  size_t                                    m_known_cell_count{0};
+  bool                                      m_pheromone_repeat_deposit;
+  const double                              mc_pheromone_rho;
+  const bool                                mc_lazy_decay;
+  const bool                                mc_tiled;
+  const rtypes::discretize_ratio            mc_resolution;
+
+  size_t                                    m_xdsize;
+  size_t                                    m_ydsize;
+  size_t                                    m_tile_xdim;
+  size_t                                    m_tile_ydim;
+  size_t                                    m_n_ytiles;
+
+  /**
+   * \brief Tiles are allocated on first access, which can happen through a
+   * logically const read of a cell which has never been observed.
+   */
+  mutable std::vector<std::unique_ptr<tile>> m_tiles{};
+
+  std::vector<rmath::vector2z>              m_expired{};
 
-  size_t                              m_known_cell_count{0};
-  bool                                m_pheromone_repeat_deposit;
+  size_t                                    m_tick{0};
+  std::vector<rmath::vector2z>              m_lazy_dirty{};
+  expiry_queue                              m_lazy_expiry{};
   /* clang-format on */
 };
 
 NS_END(ds, perception, subsystem, fordyca);
-
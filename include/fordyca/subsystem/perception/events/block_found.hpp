@@ -30,6 +30,7 @@
 #include "cosm/ds/operations/cell2D_op.hpp"
 #include "cosm/repr/sim_block3D.hpp"
 
+#include "fordyca/repr/dpo_snapshot_pool.hpp"
 #include "fordyca/subsystem/perception/model_update_result.hpp"
 #include "fordyca/subsystem/perception/perception_fwd.hpp"
 
@@ -38,6 +39,13 @@
  ******************************************************************************/
 NS_START(fordyca, subsystem, perception, events);
 
+/**
+ * \brief The pool of block snapshots shared by all robots in the swarm, with
+ * snapshots versioned by the real location of the block.
+ */
+using block_snapshot_pool = repr::dpo_snapshot_pool<crepr::sim_block3D,
+                                                    rmath::vector2d>;
+
 /*******************************************************************************
  * Class Definitions
  ******************************************************************************/
@@ -60,7 +68,7 @@ class block_found : public rer::client<block_found>, public cdops::cell2D_op {
  public:
   using visit_typelist = visit_typelist_impl::value;
 
-  explicit block_found(crepr::sim_block3D* block);
+  explicit block_found(const crepr::sim_block3D* block);
   ~block_found(void) override = default;
 
   block_found(const block_found&) = delete;
@@ -76,7 +84,7 @@ class block_found : public rer::client<block_found>, public cdops::cell2D_op {
 
  private:
   /* clang-format off */
-  crepr::sim_block3D* m_block;
+  const crepr::sim_block3D* m_block;
   /* clang-format on */
 };
 
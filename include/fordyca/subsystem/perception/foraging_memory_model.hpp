@@ -144,7 +144,7 @@ class foraging_memory_model : public csperception::base_memory_model,
    *
    * \return \c TRUE if a block was removed, \c FALSE otherwise.
    */
-  virtual bool block_remove(crepr::sim_block3D* victim) = 0;
+  virtual bool block_remove(const crepr::sim_block3D* victim) = 0;
 
  private:
   /* clang-format off */
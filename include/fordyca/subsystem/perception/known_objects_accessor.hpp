@@ -24,6 +24,7 @@
  * Includes
  ******************************************************************************/
 #include <boost/optional.hpp>
+#include <boost/range/any_range.hpp>
 
 #include "rcppsw/math/vector2.hpp"
 
@@ -44,17 +45,33 @@ NS_START(fordyca, subsystem, perception);
  *
  * \brief Defines the interface for extracting information about currently
  * known objects, without tracking information (i.e., "raw" tracked objects).
+ *
+ * Prefer the \c _range() accessors and \ref n_known_blocks()/\ref
+ * n_known_caches() over \ref known_blocks()/\ref known_caches() where
+ * possible: the latter copy the set of known objects into a new vector on each
+ * call, which is only needed if the set of known objects is modified while it
+ * is being iterated over.
  */
 class known_objects_accessor {
  public:
+  using known_blocks_range_type = boost::any_range<const crepr::sim_block3D*,
+                                                   boost::forward_traversal_tag,
+                                                   const crepr::sim_block3D*,
+                                                   std::ptrdiff_t>;
+  using known_caches_range_type = boost::any_range<carepr::base_cache*,
+                                                   boost::forward_traversal_tag,
+                                                   carepr::base_cache*,
+                                                   std::ptrdiff_t>;
+
   known_objects_accessor(void) = default;
   virtual ~known_objects_accessor(void) = default;
 
   /**
    * \brief Get all known blocks the robot is currently aware of, sans tracking
-   * information.
+   * information. Known blocks are shared with other robots, and so cannot be
+   * modified.
    */
-  virtual cds::block3D_vectorno known_blocks(void) const = 0;
+  virtual cds::block3D_vectorro known_blocks(void) const = 0;
 
   /**
    * \brief Get all known caches the robot is currently aware of, sans tracking
@@ -62,6 +79,23 @@ class known_objects_accessor {
    */
   virtual cads::bcache_vectorno known_caches(void) const = 0;
 
+  /**
+   * \brief Get a view of all known blocks the robot is currently aware of, sans
+   * tracking information. The view is invalidated if the set of known blocks
+   * is modified.
+   */
+  virtual known_blocks_range_type known_blocks_range(void) const = 0;
+
+  /**
+   * \brief Get a view of all known caches the robot is currently aware of, sans
+   * tracking information. The view is invalidated if the set of known caches
+   * is modified.
+   */
+  virtual known_caches_range_type known_caches_range(void) const = 0;
+
+  virtual size_t n_known_blocks(void) const = 0;
+  virtual size_t n_known_caches(void) const = 0;
+
   boost::optional<rmath::vector2d> last_block_loc(void) const {
     return m_last_block_loc;
   }
@@ -0,0 +1,95 @@
+/**
+ * \file los_verify_policy.hpp
+ *
+ * \copyright 2022 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#pragma once
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <string>
+
+#include "rcppsw/er/client.hpp"
+#include "rcppsw/math/rng.hpp"
+
+#include "fordyca/fordyca.hpp"
+#include "fordyca/subsystem/perception/config/los_verify_config.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, subsystem, perception);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class los_verify_policy
+ * \ingroup subsystem perception
+ *
+ * \brief Decides whether a robot should run \ref los_proc_verify after
+ * processing its LOS on a given timestep, so that long experiments can run
+ * with assertions enabled without paying for verification every timestep for
+ * every robot. Policies:
+ *
+ * - \c always - Verify every timestep (default).
+ * - \c interval - Verify every N timesteps.
+ * - \c sampled - A random subset of 1 in K robots verify every timestep; the
+ *   remaining robots never verify.
+ * - \c off - Never verify.
+ */
+class los_verify_policy : public rer::client<los_verify_policy> {
+ public:
+  static inline const std::string kALWAYS = "always";
+  static inline const std::string kINTERVAL = "interval";
+  static inline const std::string kSAMPLED = "sampled";
+  static inline const std::string kOFF = "off";
+
+  /**
+   * \param config The policy configuration.
+   * \param rng The robot's RNG, used to decide if the robot is selected under
+   *            the \c sampled policy.
+   */
+  los_verify_policy(const config::los_verify_config* config, rmath::rng* rng);
+
+  los_verify_policy(const los_verify_policy&) = delete;
+  los_verify_policy& operator=(const los_verify_policy&) = delete;
+
+  /**
+   * \brief Determine if LOS verification should be performed this
+   * timestep. Should be called exactly once per perception update.
+   */
+  bool verify(void);
+
+  /**
+   * \brief Was verification performed during the most recent perception
+   * update?
+   */
+  bool last_verified(void) const { return m_last_verified; }
+
+ private:
+  /* clang-format off */
+  const config::los_verify_config mc_config;
+  bool                            m_selected{true};
+  size_t                          m_step{0};
+  bool                            m_last_verified{false};
+  /* clang-format on */
+};
+
+NS_END(perception, subsystem, fordyca);
@@ -31,6 +31,7 @@
 
 #include "fordyca/subsystem/perception/config/perception_config.hpp"
 #include "fordyca/subsystem/perception/foraging_perception_subsystem.hpp"
+#include "fordyca/subsystem/perception/los_verify_policy.hpp"
 #include "fordyca/fordyca.hpp"
 #include "fordyca/metrics/perception/mdpo_metrics.hpp"
 #include "fordyca/repr/forager_los.hpp"
@@ -56,7 +57,8 @@ class mdpo_perception_subsystem final
       public foraging_perception_subsystem,
       public metrics::perception::mdpo_metrics {
  public:
-  explicit mdpo_perception_subsystem(const config::perception_config* config);
+  mdpo_perception_subsystem(const config::perception_config* config,
+                            rmath::rng* rng);
   ~mdpo_perception_subsystem(void) override;
 
   /* world model metrics */
@@ -66,6 +68,7 @@ class mdpo_perception_subsystem final
   void reset_metrics(void) override;
   double known_percentage(void) const override RCPPSW_PURE;
   double unknown_percentage(void) const override RCPPSW_PURE;
+  bool los_verified(void) const override RCPPSW_PURE;
 
   /* foraging_perception_subsystem overrides */
   const known_objects_accessor* known_objects(void) const override RCPPSW_PURE;
@@ -103,6 +106,7 @@ class mdpo_perception_subsystem final
   /* clang-format off */
   std::vector<size_t>                   m_cell_stats;
   std::unique_ptr<repr::forager_los>    m_los;
+  los_verify_policy                     m_verify;
   /* clang-format on */
 };
 
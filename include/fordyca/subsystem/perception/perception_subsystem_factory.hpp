@@ -26,6 +26,7 @@
 #include <string>
 
 #include "rcppsw/patterns/factory/factory.hpp"
+#include "rcppsw/math/rng.hpp"
 #include "fordyca/fordyca.hpp"
 
 #include "fordyca/subsystem/perception/foraging_perception_subsystem.hpp"
@@ -49,7 +50,8 @@ NS_START(fordyca, subsystem, perception);
 class perception_subsystem_factory :
     public rpfactory::releasing_factory<fsperception::foraging_perception_subsystem,
                                         std::string, /* key type */
-                                        const config::perception_config*> {
+                                        const config::perception_config*,
+                                        rmath::rng*> {
  public:
   static inline const std::string kDPO = "dpo";
   static inline const std::string kMDPO = "mdpo";
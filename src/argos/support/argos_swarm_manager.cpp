@@ -40,7 +40,9 @@
 #include "fordyca/argos/support/tv/env_dynamics.hpp"
 #include "fordyca/argos/support/tv/fordyca_pd_adaptor.hpp"
 #include "fordyca/argos/support/tv/tv_manager.hpp"
+#include "fordyca/controller/cognitive/cognitive_controller.hpp"
 #include "fordyca/controller/foraging_controller.hpp"
+#include "fordyca/subsystem/perception/events/block_found.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -90,6 +92,14 @@ void argos_swarm_manager::init(ticpp::Element& node) {
 
   /* initialize oracle, if configured */
   oracle_init(config()->config_get<coconfig::aggregate_oracle_config>());
+
+  /* initialize perception updates in the loop functions, if configured */
+  perception_phase_init(
+      config()->config_get<fasupport::config::perception_phase_config>());
+
+  /* initialize robot interaction processing */
+  interaction_phase_init(
+      config()->config_get<fasupport::config::interaction_phase_config>());
 } /* init() */
 
 void argos_swarm_manager::config_parse(ticpp::Element& node) {
@@ -167,6 +177,39 @@ void argos_swarm_manager::oracle_init(
   }
 } /* oracle_init() */
 
+void argos_swarm_manager::perception_phase_init(
+    const fasupport::config::perception_phase_config* const config) {
+  if (nullptr == config || !config->enable) {
+    return;
+  }
+  ER_INFO("Enabling perception phase");
+  m_perception_phase = true;
+
+  /*
+   * Robots without perception models (i.e., reactive controllers) are
+   * unaffected. Static order because ARGoS threads are not set up yet.
+   */
+  auto cb = [&](auto* c) {
+    auto* cognitive =
+        dynamic_cast<controller::cognitive::cognitive_controller*>(c);
+    if (nullptr != cognitive) {
+      cognitive->perception_external(true);
+    }
+  };
+  cpargos::swarm_iterator::controllers<controller::foraging_controller,
+                                       cpal::iteration_order::ekSTATIC>(
+      this, cb, cpal::kRobotType);
+} /* perception_phase_init() */
+
+void argos_swarm_manager::interaction_phase_init(
+    const fasupport::config::interaction_phase_config* const config) {
+  if (nullptr == config || !config->serial) {
+    return;
+  }
+  ER_INFO("Processing robot interactions in a serial pass");
+  m_interactions_serial = true;
+} /* interaction_phase_init() */
+
 /*******************************************************************************
  * ARGoS Hooks
  ******************************************************************************/
@@ -177,6 +220,7 @@ void argos_swarm_manager::pre_step(void) {
   auto status = arena_map()->pre_step_update(timestep());
   if (carena::update_status::ekBLOCK_MOTION == status) {
     floor()->SetChanged();
+    oracle_invalidate();
   }
 
   /*
@@ -187,9 +231,14 @@ void argos_swarm_manager::pre_step(void) {
     m_tv_manager->update(timestep());
   }
 
-  if (nullptr != oracle()) {
-    oracle()->update(arena_map());
-  }
+  /*
+   * The oracle is rebuilt once per timestep after all robot interactions in
+   * the loop function post-step, so it only needs to be rebuilt here if
+   * blocks moved in the arena update above (or on the first timestep after a
+   * reset). Robots consume the oracle during their control steps, which all
+   * run after this.
+   */
+  oracle_refresh();
 } /* pre_step() */
 
 void argos_swarm_manager::post_step(void) {
@@ -206,11 +255,67 @@ void argos_swarm_manager::post_step(void) {
 void argos_swarm_manager::reset(void) {
   swarm_manager_adaptor::reset();
   arena_map()->initialize(this, nullptr);
+  oracle_invalidate();
+
+  /* blocks are redistributed, so pooled snapshots are out of date */
+  fspevents::block_snapshot_pool::instance().clear();
 } /* reset() */
 
 /*******************************************************************************
  * Member Functions
  ******************************************************************************/
+void argos_swarm_manager::robot_perception_update(
+    controller::foraging_controller* const controller) {
+  if (!m_perception_phase) {
+    return;
+  }
+  /*
+   * Called from the per-robot pre-step callback, which can run in parallel
+   * with that of other robots. Robot perception models are independent of
+   * each other, so this needs no locking.
+   */
+  auto* cognitive =
+      dynamic_cast<controller::cognitive::cognitive_controller*>(controller);
+  if (nullptr != cognitive) {
+    cognitive->perception_update();
+  }
+} /* robot_perception_update() */
+
+void argos_swarm_manager::robots_post_step(
+    const std::function<void(controller::foraging_controller*)>& interact,
+    const std::function<void(controller::foraging_controller*)>& collect) {
+  if (!m_interactions_serial) {
+    auto cb = [&](::argos::CControllableEntity* robot) {
+      auto* controller =
+          static_cast<controller::foraging_controller*>(&robot->GetController());
+      interact(controller);
+      collect(controller);
+    };
+    cpargos::swarm_iterator::robots<cpal::iteration_order::ekDYNAMIC>(this, cb);
+    return;
+  }
+
+  /*
+   * Static order is always the same (the order robots were added to the
+   * simulation), and does not use ARGoS threads, so we are still only using
+   * them once for this timestep.
+   */
+  cpargos::swarm_iterator::controllers<controller::foraging_controller,
+                                       cpal::iteration_order::ekSTATIC>(
+      this, interact, cpal::kRobotType);
+
+  auto cb = [&](::argos::CControllableEntity* robot) {
+    collect(static_cast<controller::foraging_controller*>(&robot->GetController()));
+  };
+  cpargos::swarm_iterator::robots<cpal::iteration_order::ekDYNAMIC>(this, cb);
+} /* robots_post_step() */
+
+void argos_swarm_manager::oracle_refresh(void) {
+  if (nullptr != oracle() && m_oracle_stale.exchange(false)) {
+    oracle()->update(arena_map());
+  }
+} /* oracle_refresh() */
+
 const carena::caching_arena_map* argos_swarm_manager::arena_map(void) const {
   return static_cast<const carena::caching_arena_map*>(
       swarm_manager_adaptor::arena_map());
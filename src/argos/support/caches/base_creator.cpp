@@ -33,6 +33,8 @@
 #include "cosm/foraging/block_dist/base_distributor.hpp"
 #include "cosm/repr/sim_block3D.hpp"
 
+#include "fordyca/argos/support/caches/caches_er.hpp"
+
 /*******************************************************************************
  * Namespaces
  ******************************************************************************/
@@ -87,9 +89,9 @@ base_creator::create_single_cache(const rmath::vector2d& center,
        * will be the first block picked up by a robot from the new cache. This
        * helps to ensure fairness/better statistics for the simulations.
        */
-      ER_DEBUG("Add block%d from cache host cell@%s to block vector",
-               cell.block3D()->id().v(),
-               rcppsw::to_string(dcenter).c_str());
+      CACHES_ER_DEBUG("Add block%d from cache host cell@%s to block vector",
+                      cell.block3D()->id().v(),
+                      rcppsw::to_string(dcenter).c_str());
       blocks.insert(blocks.begin(), cell.block3D());
     }
   }
@@ -98,20 +100,20 @@ base_creator::create_single_cache(const rmath::vector2d& center,
    * If blocks have not been distributed yet, nothing to do.
    */
   if (!pre_dist) {
-    ER_INFO("Clearing host cells and block extents for %zu blocks",
-            blocks.size());
+    CACHES_ER_INFO("Clearing host cells and block extents for %zu blocks",
+                   blocks.size());
     /*
      * We don't need to lock around the cell empty and block drop events because
      * cache creation always happens AFTER all robots have had their control
      * steps run, never DURING.
      */
     for (auto& block : blocks) {
-      ER_DEBUG("Clearing block%d host cell@%s,extents: x=%s,y=%s, removing from "
-               "cluster",
-               block->id().v(),
-               rcppsw::to_string(block->danchor2D()).c_str(),
-               rcppsw::to_string(block->xdspan()).c_str(),
-               rcppsw::to_string(block->ydspan()).c_str());
+      CACHES_ER_DEBUG("Clearing block%d host cell@%s,extents: x=%s,y=%s, "
+                      "removing from cluster",
+                      block->id().v(),
+                      rcppsw::to_string(block->danchor2D()).c_str(),
+                      rcppsw::to_string(block->xdspan()).c_str(),
+                      rcppsw::to_string(block->ydspan()).c_str());
 
       auto pickup_op = caops::free_block_pickup_visitor::by_arena(block);
       /*
@@ -135,9 +137,9 @@ base_creator::create_single_cache(const rmath::vector2d& center,
     drop_op.visit(*block);
   } /* for(block..) */
 
-  ER_DEBUG("All %zu blocks now in host cell%s",
-           blocks.size(),
-           rcppsw::to_string(dcenter).c_str());
+  CACHES_ER_DEBUG("All %zu blocks now in host cell%s",
+                  blocks.size(),
+                  rcppsw::to_string(dcenter).c_str());
 
   /* create the cache! */
   cds::block3D_vectorno for_cache(blocks.begin(), blocks.end());
@@ -163,19 +165,19 @@ base_creator::create_single_cache(const rmath::vector2d& center,
            ret->id().v(),
            rcppsw::to_string(ret->dcenter2D()).c_str(),
            rcppsw::to_string(dcenter).c_str());
-  ER_INFO("Created cache%d@%s/%s,anchor=%s/%s,xspan=%s/%s,yspan=%s/%s with %zu "
-          "blocks [%s]",
-          ret->id().v(),
-          rcppsw::to_string(ret->rcenter2D()).c_str(),
-          rcppsw::to_string(ret->dcenter2D()).c_str(),
-          rcppsw::to_string(ret->ranchor2D()).c_str(),
-          rcppsw::to_string(ret->danchor2D()).c_str(),
-          rcppsw::to_string(ret->xrspan()).c_str(),
-          rcppsw::to_string(ret->xdspan()).c_str(),
-          rcppsw::to_string(ret->yrspan()).c_str(),
-          rcppsw::to_string(ret->ydspan()).c_str(),
-          ret->n_blocks(),
-          rcppsw::to_string(blocks).c_str());
+  CACHES_ER_INFO("Created cache%d@%s/%s,anchor=%s/%s,xspan=%s/%s,yspan=%s/%s "
+                 "with %zu blocks [%s]",
+                 ret->id().v(),
+                 rcppsw::to_string(ret->rcenter2D()).c_str(),
+                 rcppsw::to_string(ret->dcenter2D()).c_str(),
+                 rcppsw::to_string(ret->ranchor2D()).c_str(),
+                 rcppsw::to_string(ret->danchor2D()).c_str(),
+                 rcppsw::to_string(ret->xrspan()).c_str(),
+                 rcppsw::to_string(ret->xdspan()).c_str(),
+                 rcppsw::to_string(ret->yrspan()).c_str(),
+                 rcppsw::to_string(ret->ydspan()).c_str(),
+                 ret->n_blocks(),
+                 rcppsw::to_string(blocks).c_str());
 
   /* Update host cell */
   cell.entity(ret.get());
@@ -31,6 +31,8 @@
 #include "cosm/repr/sim_block3D.hpp"
 #include "cosm/spatial/dimension_checker.hpp"
 
+#include "fordyca/argos/support/caches/caches_er.hpp"
+
 /*******************************************************************************
  * Namespaces/Decls
  ******************************************************************************/
@@ -47,12 +49,13 @@ base_manager::creation_blocks_alloc(
     const block_alloc_filter_type& usable_filter,
     const block_alloc_filter_type& absorbable_filter) {
   creation_blocks allocated;
+  auto membership = block_membership_calc(existing_caches, clusters);
 
   std::copy_if(all_blocks.begin(),
                all_blocks.end(),
                std::back_inserter(allocated.usable),
                [&](const auto* b) {
-                 return usable_filter(b, existing_caches, clusters);
+                 return usable_filter(b, membership);
                });
 
   auto absorbable_transform = [&](auto* b) { return std::make_pair(b->id(), b); };
@@ -62,7 +65,7 @@ base_manager::creation_blocks_alloc(
       all_blocks.end(),
       std::inserter(allocated.absorbable, allocated.absorbable.begin()),
       [&](const auto* b) {
-        return absorbable_filter(b, existing_caches, clusters);
+        return absorbable_filter(b, membership);
       },
       absorbable_transform);
 
@@ -74,6 +77,24 @@ base_manager::creation_blocks_alloc(
   }
 } /* creation_blocks_alloc() */
 
+base_manager::block_membership base_manager::block_membership_calc(
+    const cads::acache_vectorno& existing_caches,
+    const cfds::block3D_cluster_vectorro& clusters) const {
+  block_membership membership;
+  for (const auto* cache : existing_caches) {
+    for (const auto* b : cache->blocks()) {
+      membership.cache[b->id().v()] = cache->id().v();
+    } /* for(*b..) */
+  } /* for(*cache..) */
+
+  for (const auto* clust : clusters) {
+    for (const auto* b : clust->blocks()) {
+      membership.cluster[b->id().v()] = clust->id().v();
+    } /* for(*b..) */
+  } /* for(*clust..) */
+  return membership;
+} /* block_membership_calc() */
+
 bool base_manager::creation_blocks_alloc_check(
     const creation_blocks& c_allocated,
     const cads::acache_vectorno& c_existing_caches) const {
@@ -93,21 +114,27 @@ bool base_manager::creation_blocks_alloc_check(
                            [&](const auto& c) { return !c->contains_block(b); }));
         });
 
-    std::string accum;
-    std::for_each(
-        c_allocated.usable.begin(), c_allocated.usable.end(), [&](const auto& b) {
-          accum += "b" + rcppsw::to_string(b->id()) + "->fb" +
-                   rcppsw::to_string(b->md()->robot_id()) + ",";
-        });
-    ER_DEBUG("Block carry statuses: [%s]", accum.c_str());
-
-    accum = "";
-    std::for_each(
-        c_allocated.usable.begin(), c_allocated.usable.end(), [&](const auto& b) {
-          accum += "b" + rcppsw::to_string(b->id()) + "->" +
-                   b->ranchor2D().to_str() + "/" + b->danchor2D().to_str() + ",";
-        });
-    ER_DEBUG("Block locations: [%s]", accum.c_str());
+    /* these can be very long, so only build them if they will be logged */
+    if (CACHES_ER_DEBUG_ENABLED()) {
+      std::string accum;
+      std::for_each(c_allocated.usable.begin(),
+                    c_allocated.usable.end(),
+                    [&](const auto& b) {
+                      accum += "b" + rcppsw::to_string(b->id()) + "->fb" +
+                               rcppsw::to_string(b->md()->robot_id()) + ",";
+                    });
+      ER_DEBUG("Block carry statuses: [%s]", accum.c_str());
+
+      accum = "";
+      std::for_each(c_allocated.usable.begin(),
+                    c_allocated.usable.end(),
+                    [&](const auto& b) {
+                      accum += "b" + rcppsw::to_string(b->id()) + "->" +
+                               b->ranchor2D().to_str() + "/" +
+                               b->danchor2D().to_str() + ",";
+                    });
+      ER_DEBUG("Block locations: [%s]", accum.c_str());
+    }
 
     ER_CHECK(c_allocated.usable.size() - count < mc_config.dynamic.min_blocks,
              "For new caches, %zu blocks SHOULD be available, but only %zu "
@@ -0,0 +1,77 @@
+/**
+ * \file cache_index.cpp
+ *
+ * \copyright 2022 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "fordyca/argos/support/caches/cache_index.hpp"
+
+#include "cosm/arena/repr/arena_cache.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(fordyca, argos, support, caches);
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+void cache_index::update(const cads::acache_vectorno& caches) {
+  /*
+   * No per-cache mutexes can be held here, because the caller holds the arena
+   * cache mutex as a writer, so they can just be recreated.
+   */
+  m_by_id.clear();
+  m_mtxs.clear();
+  m_spatial.clear();
+  for (size_t i = 0; i < caches.size(); ++i) {
+    m_by_id[caches[i]->id().v()] = caches[i];
+    m_mtxs[caches[i]->id().v()] = std::make_unique<std::mutex>();
+    m_spatial.insert(caches[i]->rcenter2D(), { i, caches[i] });
+  } /* for(i..) */
+} /* update() */
+
+carepr::arena_cache* cache_index::find(const rtypes::type_uuid& id) const {
+  auto it = m_by_id.find(id.v());
+  return (m_by_id.end() == it) ? nullptr : it->second;
+} /* find() */
+
+std::mutex* cache_index::mtx(const rtypes::type_uuid& id) const {
+  auto it = m_mtxs.find(id.v());
+  return (m_mtxs.end() == it) ? nullptr : it->second.get();
+} /* mtx() */
+
+carepr::arena_cache* cache_index::within(const rmath::vector2d& pos,
+                                         const rtypes::spatial_dist& dist) const {
+  /*
+   * The spatial hash is conservative, so do the exact distance check, and take
+   * the first matching cache in the order of the arena cache vector to match
+   * what a linear scan of the arena caches would return.
+   */
+  std::pair<size_t, carepr::arena_cache*> first = { 0, nullptr };
+  m_spatial.query(pos, dist, [&](const auto& entry) {
+    if (dist >= (entry.second->rcenter2D() - pos).length() &&
+        (nullptr == first.second || entry.first < first.first)) {
+      first = entry;
+    }
+  });
+  return first.second;
+} /* within() */
+
+NS_END(caches, support, argos, fordyca);
@@ -23,6 +23,9 @@
  ******************************************************************************/
 #include "fordyca/argos/support/caches/creation_verifier.hpp"
 
+#include <algorithm>
+#include <unordered_set>
+
 #include "cosm/arena/caching_arena_map.hpp"
 #include "cosm/arena/free_blocks_calculator.hpp"
 #include "cosm/arena/repr/arena_cache.hpp"
@@ -30,6 +33,8 @@
 #include "cosm/repr/nest.hpp"
 #include "cosm/repr/sim_block3D.hpp"
 
+#include "fordyca/argos/support/caches/caches_er.hpp"
+
 /*******************************************************************************
  * Namespaces
  ******************************************************************************/
@@ -44,21 +49,29 @@ creation_verifier::creation_verifier(carena::caching_arena_map* const map,
     : ER_CLIENT_INIT("fordyca.argos.support.creation_verifier"),
       mc_cache_dim(cache_dim),
       mc_strict_constraints(strict_constraints),
-      m_map(map) {}
+      m_map(map),
+      m_cache_index(cache_dim),
+      m_block_index(cache_dim) {}
 
 /*******************************************************************************
  * Member Functions
  ******************************************************************************/
 bool creation_verifier::verify_single(
-    RCPPSW_UNUSED const carepr::arena_cache* cache,
-    const cads::acache_vectorro& c_caches,
+    const carepr::arena_cache* cache,
     const cds::block3D_vectorno& c_all_blocks,
-    const cfds::block3D_cluster_vectorro& c_clusters) const {
-  auto free_blocks =
-      carena::free_blocks_calculator(false)(c_all_blocks, c_caches);
+    const cfds::block3D_cluster_vectorro& c_clusters) {
+  /*
+   * The set of arena blocks does not change between calls, so only index them
+   * once; blocks which move are re-indexed via block_relocated().
+   */
+  if (m_block_index.empty()) {
+    for (auto* b : c_all_blocks) {
+      block_index_add(b);
+    } /* for(*b..) */
+  }
 
-  bool sanity_ok =
-      sanity_checks(c_caches, free_blocks, c_clusters, m_map->nests());
+  bool sanity_ok = sanity_checks_incremental(
+      cache, c_clusters, m_block_owners, [](const auto*) { return true; });
   if (!sanity_ok) {
     if (mc_strict_constraints) {
       ER_WARN("Bad cache%d@%s/%s creation--discard (strict constraints)",
@@ -71,17 +84,165 @@ bool creation_verifier::verify_single(
               cache->id().v(),
               rcppsw::to_string(cache->rcenter2D()).c_str(),
               rcppsw::to_string(cache->dcenter2D()).c_str());
+      index_add(cache);
       return true;
     }
   } else {
-    ER_INFO("Cache%d@%s/%s creation sanity checks OK",
-            cache->id().v(),
-            rcppsw::to_string(cache->rcenter2D()).c_str(),
-            rcppsw::to_string(cache->dcenter2D()).c_str());
+    CACHES_ER_INFO("Cache%d@%s/%s creation sanity checks OK",
+                   cache->id().v(),
+                   rcppsw::to_string(cache->rcenter2D()).c_str(),
+                   rcppsw::to_string(cache->dcenter2D()).c_str());
+    index_add(cache);
     return true;
   }
 } /* verify_single() */
 
+void creation_verifier::block_relocated(crepr::sim_block3D* block) {
+  auto it = m_block_extents.find(block->id().v());
+
+  /* not indexed yet--will be indexed at its current location */
+  if (m_block_extents.end() == it) {
+    return;
+  }
+  m_block_index.remove(it->second.first, it->second.second, block);
+  block_index_add(block);
+} /* block_relocated() */
+
+cads::acache_vectorro creation_verifier::audit(
+    const cds::block3D_vectorno& c_all_blocks,
+    const cfds::block3D_cluster_vectorro& c_clusters) const {
+  auto free_blocks =
+      carena::free_blocks_calculator(false)(c_all_blocks, m_verified);
+  if (sanity_checks(m_verified, free_blocks, c_clusters, m_map->nests())) {
+    return {};
+  }
+
+  /*
+   * Find the offending cache(s) using the indices, checking each cache only
+   * against the caches verified before it which did not fail, rather than
+   * re-running the full checks.
+   */
+  cads::acache_vectorro bad;
+  std::unordered_set<const carepr::arena_cache*> ok;
+  std::unordered_map<int, int> owners;
+  for (const auto* c : m_verified) {
+    if (sanity_checks_incremental(c, c_clusters, owners, [&](const auto* other) {
+          return ok.end() != ok.find(other);
+        })) {
+      ok.insert(c);
+      for (const auto* b : c->blocks()) {
+        owners[b->id().v()] = c->id().v();
+      } /* for(*b..) */
+    } else {
+      bad.push_back(c);
+    }
+  } /* for(*c..) */
+  return bad;
+} /* audit() */
+
+bool creation_verifier::sanity_checks_incremental(
+    const carepr::arena_cache* cache,
+    const cfds::block3D_cluster_vectorro& c_clusters,
+    const std::unordered_map<int, int>& c_owners,
+    const cache_filter_type& c_against) const {
+  rmath::vector2d ll(cache->xrspan().lb(), cache->yrspan().lb());
+  rmath::vector2d ur(cache->xrspan().ub(), cache->yrspan().ub());
+
+  ER_CHECK(RCPPSW_IS_ODD(cache->ddims2D().x()) &&
+               RCPPSW_IS_ODD(cache->ddims2D().y()),
+           "Cache%d@%s/%s does not have a defined center: size=%s",
+           cache->id().v(),
+           rcppsw::to_string(cache->rcenter2D()).c_str(),
+           rcppsw::to_string(cache->dcenter2D()).c_str(),
+           rcppsw::to_string(cache->ddims2D()).c_str());
+
+  ER_CHECK(sanity_check_internal_consistency(cache),
+           "Cache%d@%s/%s not internally consistent",
+           cache->id().v(),
+           rcppsw::to_string(cache->rcenter2D()).c_str(),
+           rcppsw::to_string(cache->dcenter2D()).c_str());
+
+  ER_CHECK(sanity_check_free_block_overlap(cache, free_blocks_near(cache)),
+           "Cache%d overlaps with free blocks",
+           cache->id().v());
+
+  if (!mc_strict_constraints) {
+    ER_CHECK(sanity_check_block_cluster_overlap(cache, c_clusters),
+             "Cache%d overlaps with one or more block clusters",
+             cache->id().v());
+  }
+
+  ER_CHECK(sanity_check_nest_overlap(cache, m_map->nests()),
+           "Cache%d overlaps with one or more nests",
+           cache->id().v());
+
+  /* cross consistency: no duplicate blocks, and no blocks in other caches */
+  ER_CHECK(cache->blocks().end() == std::adjacent_find(cache->blocks().begin(),
+                                                       cache->blocks().end()),
+           "Multiple blocks with the same ID in cache%d",
+           cache->id().v());
+  for (const auto* b : cache->blocks()) {
+    auto it = c_owners.find(b->id().v());
+    ER_CHECK(c_owners.end() == it,
+             "Block%d contained in both cache%d and cache%d",
+             b->id().v(),
+             cache->id().v(),
+             it->second);
+  } /* for(*b..) */
+
+  /* overlap with any of the (nearby) previously verified caches */
+  {
+    cads::acache_vectorro nearby = { cache };
+    m_cache_index.query(ll, ur, [&](const auto* c) {
+      if (c_against(c) &&
+          nearby.end() == std::find(nearby.begin(), nearby.end(), c)) {
+        nearby.push_back(c);
+      }
+    });
+    ER_CHECK(sanity_check_cache_overlap(nearby),
+             "Cache%d overlaps one or more caches",
+             cache->id().v());
+  }
+  return true;
+
+error:
+  return false;
+} /* sanity_checks_incremental() */
+
+cds::block3D_vectorno
+creation_verifier::free_blocks_near(const carepr::arena_cache* cache) const {
+  cds::block3D_vectorno candidates;
+  m_block_index.query(
+      rmath::vector2d(cache->xrspan().lb(), cache->yrspan().lb()),
+      rmath::vector2d(cache->xrspan().ub(), cache->yrspan().ub()),
+      [&](auto* b) {
+        if (m_block_owners.end() == m_block_owners.find(b->id().v()) &&
+            candidates.end() ==
+                std::find(candidates.begin(), candidates.end(), b)) {
+          candidates.push_back(b);
+        }
+      });
+  return carena::free_blocks_calculator(false)(candidates, { cache });
+} /* free_blocks_near() */
+
+void creation_verifier::block_index_add(crepr::sim_block3D* block) {
+  rmath::vector2d ll(block->xrspan().lb(), block->yrspan().lb());
+  rmath::vector2d ur(block->xrspan().ub(), block->yrspan().ub());
+  m_block_index.insert(ll, ur, block);
+  m_block_extents[block->id().v()] = { ll, ur };
+} /* block_index_add() */
+
+void creation_verifier::index_add(const carepr::arena_cache* cache) {
+  m_verified.push_back(cache);
+  m_cache_index.insert(
+      rmath::vector2d(cache->xrspan().lb(), cache->yrspan().lb()),
+      rmath::vector2d(cache->xrspan().ub(), cache->yrspan().ub()),
+      cache);
+  for (const auto* b : cache->blocks()) {
+    m_block_owners[b->id().v()] = cache->id().v();
+  } /* for(*b..) */
+} /* index_add() */
+
 bool creation_verifier::sanity_checks(
     const cads::acache_vectorro& c_caches,
     const cds::block3D_vectorno& c_free_blocks,
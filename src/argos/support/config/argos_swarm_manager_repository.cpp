@@ -24,6 +24,8 @@
 #include "fordyca/argos/support/config/argos_swarm_manager_repository.hpp"
 
 #include "fordyca/argos/support/caches/config/caches_parser.hpp"
+#include "fordyca/argos/support/config/interaction_phase_parser.hpp"
+#include "fordyca/argos/support/config/perception_phase_parser.hpp"
 #include "fordyca/argos/support/tv/config/tv_manager_parser.hpp"
 
 /*******************************************************************************
@@ -41,6 +43,10 @@ argos_swarm_manager_repository::argos_swarm_manager_repository(void) noexcept {
   parser_register<fascaches::config::caches_parser,
                   fascaches::config::caches_config>(
       fascaches::config::caches_parser::kXMLRoot);
+  parser_register<perception_phase_parser, perception_phase_config>(
+      perception_phase_parser::kXMLRoot);
+  parser_register<interaction_phase_parser, interaction_phase_config>(
+      interaction_phase_parser::kXMLRoot);
 }
 
 NS_END(config, support, argos, fordyca);
@@ -0,0 +1,48 @@
+/**
+ * \file interaction_phase_parser.cpp
+ *
+ * \copyright 2022 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "fordyca/argos/support/config/interaction_phase_parser.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, argos, support, config);
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+void interaction_phase_parser::parse(const ticpp::Element& node) {
+  /* tag is optional */
+  if (nullptr == node.FirstChild(kXMLRoot, false)) {
+    return;
+  }
+
+  ER_DEBUG("Parent node=%s: child=%s", node.Value().c_str(), kXMLRoot.c_str());
+
+  ticpp::Element pnode = node_get(node, kXMLRoot);
+  m_config = std::make_unique<config_type>();
+
+  XML_PARSE_ATTR_DFLT(pnode, m_config, serial, false);
+} /* parse() */
+
+NS_END(config, support, argos, fordyca);
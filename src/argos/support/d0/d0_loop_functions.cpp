@@ -211,15 +211,23 @@ void d0_loop_functions::post_step(void) {
   ndc_uuid_pop();
 
   /* Process all robots: interact with environment then collect metrics */
-  auto cb = [&](::argos::CControllableEntity* robot) {
+  auto interact = [&](controller::foraging_controller* controller) {
     ndc_uuid_push();
-    robot_post_step(dynamic_cast<chal::robot&>(robot->GetParent()));
+    robot_interact(controller);
     ndc_uuid_pop();
   };
-  cpargos::swarm_iterator::robots<cpal::iteration_order::ekDYNAMIC>(this, cb);
+  auto collect = [&](controller::foraging_controller* controller) {
+    ndc_uuid_push();
+    robot_metrics_collect(controller);
+    ndc_uuid_pop();
+  };
+  robots_post_step(interact, collect);
 
   ndc_uuid_push();
 
+  /* rebuild the oracle once for all robot interactions this timestep */
+  oracle_refresh();
+
   const auto* collector =
       m_metrics_manager->get<cfmetrics::block_transportee_metrics_collector>(
           cmspecs::blocks::kTransportee.scoped());
@@ -284,11 +292,13 @@ void d0_loop_functions::robot_pre_step(chal::robot& robot) {
   auto applicator = robot_los_update_applicator(controller);
   boost::apply_visitor(applicator,
                        m_los_update_map->at(controller->type_index()));
+
+  /* Update robot perception from its new LOS, if configured */
+  robot_perception_update(controller);
 } /* robot_pre_step() */
 
-void d0_loop_functions::robot_post_step(chal::robot& robot) {
-  auto* controller = static_cast<controller::foraging_controller*>(
-      &robot.GetControllableEntity().GetController());
+void d0_loop_functions::robot_interact(
+    controller::foraging_controller* const controller) {
   /*
    * Watch the robot interact with its environment after physics have been
    * updated and its controller has run.
@@ -307,20 +317,20 @@ void d0_loop_functions::robot_post_step(chal::robot& robot) {
       iapplicator, m_interactor_map->at(controller->type_index()));
 
   /*
-   * The oracle does not necessarily have up-to-date information about all
-   * blocks in the arena, as a robot could have dropped a block in the nest or
-   * picked one up, so its version of the set of free blocks in the arena is out
-   * of date. Robots processed *after* the robot that caused the event need
-   * the correct free block set to be available from the oracle upon request, to
-   * avoid asserts during on debug builds. On optimized builds the asserts are
-   * ignored/compiled out, which is not a problem, because the LOS processing
-   * errors that can result are transient and are corrected the next
-   * timestep. See FORDYCA#577.
+   * The oracle no longer has up-to-date information about all blocks in the
+   * arena, as a robot could have dropped a block in the nest or picked one
+   * up. Nothing consumes the oracle while robots are being processed (robots
+   * query it during their control steps), so rather than rebuilding it after
+   * every event, it is rebuilt once after all robots have been processed. See
+   * FORDYCA#577.
    */
-  if (fsupport::interactor_status::ekNO_EVENT != status && nullptr != oracle()) {
-    oracle()->update(arena_map());
+  if (fsupport::interactor_status::ekNO_EVENT != status) {
+    oracle_invalidate();
   }
+} /* robot_interact() */
 
+void d0_loop_functions::robot_metrics_collect(
+    controller::foraging_controller* const controller) {
   /*
    * Collect metrics from robot, now that it has finished interacting with the
    * environment and no more changes to its state will occur this timestep.
@@ -332,7 +342,7 @@ void d0_loop_functions::robot_post_step(chal::robot& robot) {
   boost::apply_visitor(mapplicator, m_metrics_map->at(controller->type_index()));
 
   controller->block_manip_recorder()->reset();
-} /* robot_post_step() */
+} /* robot_metrics_collect() */
 
 NS_END(d0, support, argos, fordyca);
 
@@ -333,6 +333,7 @@ void d1_loop_functions::cache_handling_init(
   if (auto created = m_cache_manager->create(
           ccp, arena_map()->free_blocks(true), pre_dist)) {
     arena_map()->caches_add(*created, this);
+    m_cache_manager->caches_index_update(arena_map()->caches());
     floor()->SetChanged();
   }
 } /* cache_handling_init() */
@@ -385,23 +386,27 @@ void d1_loop_functions::post_step(void) {
   ndc_uuid_pop();
 
   /*
-   * Parallel iteration over the swarm within the following set of ordered
-   * tasks:
+   * Iteration over the swarm within the following set of ordered tasks:
    *
+   * - Environment interactions
    * - Metric collection
    * - Task counts collection
    *
-   * This has to all be in 1 callback when passing to ARGoS, because we are only
-   * allowed 1 usage of ARGoS threads per PreStep()/PostStep() function call.
+   * The last two always run in parallel across ARGoS threads; the first does
+   * too unless interactions are serial.
    */
-  auto cb = [&](::argos::CControllableEntity* robot) {
+  auto interact = [&](controller::foraging_controller* controller) {
     ndc_uuid_push();
-    robot_post_step(dynamic_cast<chal::robot&>(robot->GetParent()));
-    caches_recreation_task_counts_collect(
-        &static_cast<controller::foraging_controller&>(robot->GetController()));
+    robot_interact(controller);
     ndc_uuid_pop();
   };
-  cpargos::swarm_iterator::robots<cpal::iteration_order::ekDYNAMIC>(this, cb);
+  auto collect = [&](controller::foraging_controller* controller) {
+    ndc_uuid_push();
+    robot_metrics_collect(controller);
+    caches_recreation_task_counts_collect(controller);
+    ndc_uuid_pop();
+  };
+  robots_post_step(interact, collect);
 
   ndc_uuid_push();
 
@@ -413,6 +418,12 @@ void d1_loop_functions::post_step(void) {
   m_cache_counts.n_harvesters = 0;
   m_cache_counts.n_collectors = 0;
 
+  /*
+   * Rebuild the oracle once for all robot interactions this timestep, after
+   * any static caches have been re-created.
+   */
+  oracle_refresh();
+
   /* update arena map */
   const auto* collector =
       m_metrics_manager->get<cfmetrics::block_transportee_metrics_collector>(
@@ -482,6 +493,8 @@ void d1_loop_functions::reset(void) {
     arena_map()->caches_add(*created, this);
     floor()->SetChanged();
   }
+  /* caches from before the reset are gone even if none were created */
+  m_cache_manager->caches_index_update(arena_map()->caches());
   ndc_uuid_pop();
 } /* reset() */
 
@@ -518,12 +531,13 @@ void d1_loop_functions::robot_pre_step(chal::robot& robot) {
                                       repr::forager_los>(controller);
   boost::apply_visitor(applicator,
                        m_los_update_map->at(controller->type_index()));
-} /* robot_pre_step() */
 
-void d1_loop_functions::robot_post_step(chal::robot& robot) {
-  auto* controller = static_cast<controller::foraging_controller*>(
-      &robot.GetControllableEntity().GetController());
+  /* Update robot perception from its new LOS, if configured */
+  robot_perception_update(controller);
+} /* robot_pre_step() */
 
+void d1_loop_functions::robot_interact(
+    controller::foraging_controller* const controller) {
   /*
    * Watch the robot interact with its environment after physics have been
    * updated and its controller has run.
@@ -542,25 +556,20 @@ void d1_loop_functions::robot_post_step(chal::robot& robot) {
       iapplicator, m_interactor_map->at(controller->type_index()));
 
   /*
-   * The oracle does not necessarily have up-to-date information about all
-   * blocks in the arena, as a robot could have dropped a block in the nest or
-   * picked one up, so its version of the set of free blocks in the arena is out
-   * of date. Robots processed *after* the robot that caused the event need
-   * the correct free block set to be available from the oracle upon request, to
-   * avoid asserts during on debug builds. On optimized builds the asserts are
-   * ignored/compiled out, which is not a problem, because they LOS processing
-   * errors that can result are transient and are corrected the next
-   * timestep.
-   *
-   * This is not a problem for caches, because caches are created (if needed)
-   * after *all* robots have been processed for the given timestep.
-   *
-   * See FORDYCA#577.
+   * The oracle no longer has up-to-date information about all blocks in the
+   * arena, as a robot could have dropped a block in the nest or picked one
+   * up. Nothing consumes the oracle while robots are being processed (robots
+   * query it during their control steps), so rather than rebuilding it after
+   * every event, it is rebuilt once after all robots have been processed. See
+   * FORDYCA#577.
    */
-  if (fsupport::interactor_status::ekNO_EVENT != status && nullptr != oracle()) {
-    oracle()->update(arena_map());
+  if (fsupport::interactor_status::ekNO_EVENT != status) {
+    oracle_invalidate();
   }
+} /* robot_interact() */
 
+void d1_loop_functions::robot_metrics_collect(
+    controller::foraging_controller* const controller) {
   /*
    * Collect metrics from robot, now that it has finished interacting with the
    * environment and no more changes to its state will occur this timestep.
@@ -578,7 +587,7 @@ void d1_loop_functions::robot_post_step(chal::robot& robot) {
   boost::apply_visitor(mapplicator,
                        m_metric_extractor_map->at(controller->type_index()));
   controller->block_manip_recorder()->reset();
-} /* robot_post_step() */
+} /* robot_metrics_collect() */
 
 void d1_loop_functions::static_cache_monitor(void) {
   /* nothing to do--all our managed caches exist */
@@ -598,7 +607,9 @@ void d1_loop_functions::static_cache_monitor(void) {
                                               m_cache_counts.n_harvesters,
                                               m_cache_counts.n_collectors)) {
     arena_map()->caches_add(*created, this);
+    m_cache_manager->caches_index_update(arena_map()->caches());
     floor()->SetChanged();
+    oracle_invalidate();
     return;
   }
   ER_INFO("Could not create static caches: n_harvesters=%zu,n_collectors=%zu",
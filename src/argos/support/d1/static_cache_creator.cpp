@@ -26,6 +26,8 @@
 #include "cosm/arena/caching_arena_map.hpp"
 #include "cosm/arena/repr/arena_cache.hpp"
 
+#include "fordyca/argos/support/caches/caches_er.hpp"
+
 /*******************************************************************************
  * Namespaces
  ******************************************************************************/
@@ -52,10 +54,10 @@ static_cache_creator::create_all(const fascaches::create_ro_params& c_params,
                                  bool pre_dist) {
   creation_result res;
   for (auto& alloc_i : c_alloc_map) {
-    ER_DEBUG("Cache%d alloced blocks: [%s] (%zu)",
-             alloc_i.first,
-             rcppsw::to_string(alloc_i.second).c_str(),
-             mc_centers.size());
+    CACHES_ER_DEBUG("Cache%d alloced blocks: [%s] (%zu)",
+                    alloc_i.first,
+                    rcppsw::to_string(alloc_i.second).c_str(),
+                    mc_centers.size());
     auto rcenter = mc_centers[alloc_i.first];
     auto dcenter = rmath::dvec2zvec(rcenter, map()->grid_resolution().v());
     auto exists =
@@ -64,10 +66,10 @@ static_cache_creator::create_all(const fascaches::create_ro_params& c_params,
                      [&](const auto& c) { return dcenter == c->dcenter2D(); });
     /* static cache already exists */
     if (c_params.current_caches.end() != exists) {
-      ER_DEBUG("Cache%d@%s/%s already exists",
-               (*exists)->id().v(),
-               rcppsw::to_string((*exists)->rcenter2D()).c_str(),
-               rcppsw::to_string((*exists)->dcenter2D()).c_str());
+      CACHES_ER_DEBUG("Cache%d@%s/%s already exists",
+                      (*exists)->id().v(),
+                      rcppsw::to_string((*exists)->rcenter2D()).c_str(),
+                      rcppsw::to_string((*exists)->dcenter2D()).c_str());
       continue;
     }
 
@@ -81,12 +83,12 @@ static_cache_creator::create_all(const fascaches::create_ro_params& c_params,
       continue;
     }
 
-    ER_INFO("Creating static cache%d@%s/%s: blocks=[%s] (%zu)",
-            alloc_i.first,
-            rcppsw::to_string(rcenter).c_str(),
-            rcppsw::to_string(dcenter).c_str(),
-            rcppsw::to_string(alloc_i.second).c_str(),
-            alloc_i.second.size());
+    CACHES_ER_INFO("Creating static cache%d@%s/%s: blocks=[%s] (%zu)",
+                   alloc_i.first,
+                   rcppsw::to_string(rcenter).c_str(),
+                   rcppsw::to_string(dcenter).c_str(),
+                   rcppsw::to_string(alloc_i.second).c_str(),
+                   alloc_i.second.size());
     auto cache = create_single_cache(
         rcenter, std::move(alloc_i.second), c_params.t, pre_dist);
     res.created.push_back(std::move(cache));
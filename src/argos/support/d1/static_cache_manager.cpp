@@ -22,6 +22,9 @@
  ******************************************************************************/
 #include "fordyca/argos/support/d1/static_cache_manager.hpp"
 
+#include <algorithm>
+#include <unordered_set>
+
 #include "cosm/arena/caching_arena_map.hpp"
 #include "cosm/arena/free_blocks_calculator.hpp"
 #include "cosm/arena/operations/free_block_drop.hpp"
@@ -30,6 +33,7 @@
 #include "cosm/repr/sim_block3D.hpp"
 #include "cosm/spatial/conflict_checker.hpp"
 
+#include "fordyca/argos/support/caches/caches_er.hpp"
 #include "fordyca/argos/support/caches/creation_verifier.hpp"
 #include "fordyca/argos/support/d1/static_cache_creator.hpp"
 #include "fordyca/math/cache_respawn_probability.hpp"
@@ -59,7 +63,7 @@ boost::optional<cads::acache_vectoro>
 static_cache_manager::create(const fascaches::create_ro_params& c_params,
                              const cds::block3D_vectorno& c_all_blocks,
                              bool initial) {
-  ER_DEBUG("(Re)-Creating static cache(s)");
+  CACHES_ER_DEBUG("(Re)-Creating static cache(s)");
   ER_ASSERT(config()->static_.size >= carepr::base_cache::kMinBlocks,
             "Static cache size %u < minimum %zu",
             config()->static_.size,
@@ -68,14 +72,12 @@ static_cache_manager::create(const fascaches::create_ro_params& c_params,
   auto usable_cb = std::bind(&static_cache_manager::block_alloc_usable_filter,
                              this,
                              std::placeholders::_1,
-                             std::placeholders::_2,
-                             std::placeholders::_3);
+                             std::placeholders::_2);
   auto absorbable_cb =
       std::bind(&static_cache_manager::block_alloc_absorbable_filter,
                 this,
                 std::placeholders::_1,
-                std::placeholders::_2,
-                std::placeholders::_3);
+                std::placeholders::_2);
   if (auto for_creation = creation_blocks_alloc(c_all_blocks,
                                                 c_params.current_caches,
                                                 c_params.clusters,
@@ -141,59 +143,109 @@ boost::optional<cads::acache_vectoro> static_cache_manager::create_conditional(
 ds::block_alloc_map static_cache_manager::blocks_alloc(
     const cds::block3D_vectorno& c_usable_blocks,
     const cds::block3D_htno& c_absorbable_blocks) const {
+  auto sites_blocks = sites_blocks_calc(c_absorbable_blocks);
+
+  /*
+   * Blocks within the extent of ANY cache-to-be cannot be part of the initial
+   * allocation for a cache. Blocks can be dropped within cache extents in (for
+   * example) RN scenarios during block distribution or due to task abort when
+   * in between when a given cache is depleted and when it is re-created; they
+   * are added to the cache whose extent they are in during absorbtion
+   * instead. Usable blocks are a subset of absorbable blocks, so all usable
+   * blocks within site extents are found this way.
+   */
+  std::unordered_set<int> in_sites;
+  for (const auto& site : sites_blocks) {
+    for (const auto* block : site) {
+      in_sites.insert(block->id().v());
+    } /* for(*block..) */
+  } /* for(&site..) */
+
+  cds::block3D_vectorno outside;
+  std::copy_if(c_usable_blocks.begin(),
+               c_usable_blocks.end(),
+               std::back_inserter(outside),
+               [&](const auto* block) {
+                 return 0 == in_sites.count(block->id().v());
+               });
+
   ds::block_alloc_map alloc_map;
+  size_t next = 0;
   for (size_t i = 0; i < mc_cache_locs.size(); ++i) {
-    if (auto cache_i = cache_i_blocks_alloc(c_usable_blocks,
-                                            c_absorbable_blocks,
-                                            alloc_map,
-                                            mc_cache_locs[i],
-                                            i,
-                                            carepr::base_cache::kMinBlocks)) {
-      alloc_map[i] = *cache_i;
+    auto n_initial = std::min(carepr::base_cache::kMinBlocks,
+                              outside.size() - next);
+    cds::block3D_vectorno initial(outside.begin() + next,
+                                  outside.begin() + next + n_initial);
+    if (auto cache_i = cache_i_blocks_alloc(
+            initial, sites_blocks[i], alloc_map, mc_cache_locs[i], i)) {
+      alloc_map.assign(i, *cache_i);
+      next += n_initial;
     } else {
-      alloc_map[i] = {};
+      alloc_map.assign(i, {});
     }
-    ER_DEBUG("Alloc_blocks=[%s] for cache%zu@%s",
-             rcppsw::to_string(alloc_map[i]).c_str(),
-             i,
-             mc_cache_locs[i].to_str().c_str());
+    CACHES_ER_DEBUG("Alloc_blocks=[%s] for cache%zu@%s",
+                    rcppsw::to_string(alloc_map.at(i)).c_str(),
+                    i,
+                    mc_cache_locs[i].to_str().c_str());
   } /* for(i..) */
   return alloc_map;
 } /* blocks_alloc() */
 
-boost::optional<cds::block3D_vectorno> static_cache_manager::cache_i_blocks_alloc(
-    const cds::block3D_vectorno& c_usable_blocks,
+std::vector<cds::block3D_vectorno> static_cache_manager::sites_blocks_calc(
+    const cds::block3D_htno& c_absorbable_blocks) const {
+  std::vector<cds::block3D_vectorno> sites(mc_cache_locs.size());
+  for (size_t i = 0; i < sites.size(); ++i) {
+    sites[i] = site_i_blocks_calc(c_absorbable_blocks, mc_cache_locs[i]);
+  } /* for(i..) */
+  return sites;
+} /* sites_blocks_calc() */
+
+cds::block3D_vectorno static_cache_manager::site_i_blocks_calc(
     const cds::block3D_htno& c_absorbable_blocks,
+    const rmath::vector2d& c_center) const {
+  cds::block3D_vectorno site_blocks;
+  rmath::vector2d cache_dim(config()->dimension.v(), config()->dimension.v());
+  using checker = cspatial::conflict_checker;
+
+  for (const auto& pair : c_absorbable_blocks) {
+    auto status =
+        checker::placement2D(c_center - cache_dim / 2.0, cache_dim, pair.second);
+    /* block overlaps with extent of cache-to-be */
+    if (status.x && status.y) {
+      site_blocks.push_back(pair.second);
+    }
+  } /* for(&pair..) */
+  return site_blocks;
+} /* site_i_blocks_calc() */
+
+boost::optional<cds::block3D_vectorno> static_cache_manager::cache_i_blocks_alloc(
+    const cds::block3D_vectorno& c_initial_blocks,
+    const cds::block3D_vectorno& c_site_blocks,
     const ds::block_alloc_map& c_alloc_map,
     const rmath::vector2d& c_center,
-    RCPPSW_UNUSED size_t cache_index,
-    size_t required_blocks) const {
-  /* initial allocation */
-  auto alloc_blocks =
-      cache_i_alloc_from_usable(c_usable_blocks, c_alloc_map, required_blocks);
-  ER_DEBUG("Cache%zu initial allocation: %s (%zu)",
-           cache_index,
-           rcppsw::to_string(alloc_blocks).c_str(),
-           alloc_blocks.size());
+    RCPPSW_UNUSED size_t cache_index) const {
+  CACHES_ER_DEBUG("Cache%zu initial allocation: %s (%zu)",
+                  cache_index,
+                  rcppsw::to_string(c_initial_blocks).c_str(),
+                  c_initial_blocks.size());
 
   /*
-   * Find all the free blocks within the extent of the cache-to-be, and add them
-   * into the block list for the new cache (absorption).
+   * Add all the blocks within the extent of the cache-to-be which are not
+   * already allocated to another cache-to-be into the block list for the new
+   * cache (absorption). Initially allocated blocks are never within the extent
+   * of any cache-to-be, so they cannot be absorbed twice.
    */
-  auto absorb_blocks = cache_i_alloc_from_absorbable(
-      c_absorbable_blocks, alloc_blocks, c_alloc_map, c_center);
-
-  /* blocks for cache i = initially allocated blocks + absorbed blocks */
-  cds::block3D_vectorno cache_i_blocks(alloc_blocks.begin(), alloc_blocks.end());
-  std::transform(absorb_blocks.begin(),
-                 absorb_blocks.end(),
-                 std::back_inserter(cache_i_blocks),
-                 [&](const auto& pair) { return pair.second; });
-
-  ER_DEBUG("Cache%zu allocation after absorbtion: %s (%zu)",
-           cache_index,
-           rcppsw::to_string(cache_i_blocks).c_str(),
-           cache_i_blocks.size());
+  cds::block3D_vectorno cache_i_blocks(c_initial_blocks.begin(),
+                                       c_initial_blocks.end());
+  std::copy_if(c_site_blocks.begin(),
+               c_site_blocks.end(),
+               std::back_inserter(cache_i_blocks),
+               [&](const auto* block) { return !c_alloc_map.contains(block); });
+
+  CACHES_ER_DEBUG("Cache%zu allocation after absorbtion: %s (%zu)",
+                  cache_index,
+                  rcppsw::to_string(cache_i_blocks).c_str(),
+                  cache_i_blocks.size());
   if (!cache_i_blocks_alloc_check(cache_i_blocks, c_center)) {
     return boost::optional<cds::block3D_vectorno>();
   }
@@ -217,21 +269,24 @@ bool static_cache_manager::cache_i_blocks_alloc_check(
           count += (b->is_out_of_sight() || b->danchor2D() == dcenter);
         });
 
-    std::string accum;
-    std::for_each(
-        cache_i_blocks.begin(), cache_i_blocks.end(), [&](const auto& b) {
-          accum += "b" + rcppsw::to_string(b->id()) + "->fb" +
-                   rcppsw::to_string(b->md()->robot_id()) + ",";
-        });
-    ER_TRACE("Cache i alloc_blocks carry statuses: [%s]", accum.c_str());
-
-    accum = "";
-    std::for_each(
-        cache_i_blocks.begin(), cache_i_blocks.end(), [&](const auto& b) {
-          accum += "b" + rcppsw::to_string(b->id()) + "->" +
-                   b->danchor2D().to_str() + ",";
-        });
-    ER_TRACE("Cache i alloc_blocks locs: [%s]", accum.c_str());
+    /* these can be very long, so only build them if they will be logged */
+    if (CACHES_ER_TRACE_ENABLED()) {
+      std::string accum;
+      std::for_each(
+          cache_i_blocks.begin(), cache_i_blocks.end(), [&](const auto& b) {
+            accum += "b" + rcppsw::to_string(b->id()) + "->fb" +
+                     rcppsw::to_string(b->md()->robot_id()) + ",";
+          });
+      ER_TRACE("Cache i alloc_blocks carry statuses: [%s]", accum.c_str());
+
+      accum = "";
+      std::for_each(
+          cache_i_blocks.begin(), cache_i_blocks.end(), [&](const auto& b) {
+            accum += "b" + rcppsw::to_string(b->id()) + "->" +
+                     b->danchor2D().to_str() + ",";
+          });
+      ER_TRACE("Cache i alloc_blocks locs: [%s]", accum.c_str());
+    }
 
     ER_ASSERT(cache_i_blocks.size() - count < carepr::base_cache::kMinBlocks,
               "For new cache @%s: %zu blocks SHOULD be "
@@ -253,57 +308,9 @@ bool static_cache_manager::cache_i_blocks_alloc_check(
   return true;
 } /* cache_i_blocks_alloc_check() */
 
-cds::block3D_vectorno static_cache_manager::cache_i_alloc_from_usable(
-    const cds::block3D_vectorno& c_usable_blocks,
-    const ds::block_alloc_map& c_alloc_map,
-    size_t required_blocks) const {
-  cds::block3D_vectorno cache_i_blocks;
-  rmath::vector2d cache_dim(config()->dimension.v(), config()->dimension.v());
-  using checker = cspatial::conflict_checker;
-  /*
-   * Note that the calculations for membership are ordered from least to most
-   * computationally expensive to compute, so don't reorder them willy-nilly.
-   */
-  std::copy_if(c_usable_blocks.begin(),
-               c_usable_blocks.end(),
-               std::back_inserter(cache_i_blocks),
-               [&](const auto& b) {
-                 return
-                     /* don't have enough blocks yet */
-                     (cache_i_blocks.size() < required_blocks) &&
-
-                     /*
-             * Not already within the extent of ANY cache (including the one we
-             * are allocating blocks for). Blocks can be dropped within cache
-             * extents in (for example) RN scenarios during block distribution
-             * or due to task abort when in between when a given cache is
-             * depleted and when it is re-created.
-             *
-             * Adding blocks within the extent of the current cache we are
-             * calculating the allocation for is done during the absorbtion
-             * phase later.
-             */
-                     std::all_of(mc_cache_locs.begin(),
-                                 mc_cache_locs.end(),
-                                 [&](const auto& center) {
-                                   auto status = checker::placement2D(
-                                       center - cache_dim / 2.0, cache_dim, b);
-
-                                   return !(status.x && status.y);
-                                 }) &&
-
-                     /* not already allocated for a different cache */
-                     !c_alloc_map.contains(b);
-               });
-  return cache_i_blocks;
-} /* cache_i_alloc_from_usable() */
-
 bool static_cache_manager::block_alloc_usable_filter(
     const crepr::sim_block3D* block,
-    const cads::acache_vectorno& existing_caches,
-    const cfds::block3D_cluster_vectorro&) const {
-  cds::block3D_vectorno cache_i_blocks;
-
+    const block_membership& membership) const {
   /*
    * Note that the calculations for membership are ordered from least to most
    * computationally expensive to compute, so don't reorder them willy-nilly.
@@ -313,56 +320,17 @@ bool static_cache_manager::block_alloc_usable_filter(
       !block->is_carried_by_robot() &&
 
       /* blocks cannot be in existing caches */
-      std::all_of(existing_caches.begin(),
-                  existing_caches.end(),
-                  [&](const auto& c) { return !c->contains_block(block); });
+      !membership.cache.count(block->id().v());
 } /* block_alloc_usable_filter() */
 
 bool static_cache_manager::block_alloc_absorbable_filter(
     const crepr::sim_block3D* block,
-    const cads::acache_vectorno& existing_caches,
-    const cfds::block3D_cluster_vectorro&) {
+    const block_membership& membership) const {
   /* blocks cannot be carried by a robot */
   return !block->is_carried_by_robot() &&
          /* Blocks cannot be in existing caches */
-         std::all_of(existing_caches.begin(),
-                     existing_caches.end(),
-                     [&](const auto& c) { return !c->contains_block(block); });
+         !membership.cache.count(block->id().v());
 } /* block_alloc_absorbable_filter() */
 
-cds::block3D_htno static_cache_manager::cache_i_alloc_from_absorbable(
-    const cds::block3D_htno& c_absorbable_blocks,
-    const cds::block3D_vectorno& c_cache_i_blocks,
-    const ds::block_alloc_map& c_alloc_map,
-    const rmath::vector2d& c_center) const {
-  cds::block3D_htno absorb_blocks;
-  rmath::vector2d cache_dim(config()->dimension.v(), config()->dimension.v());
-  using checker = cspatial::conflict_checker;
-
-  /*
-   * Note that the calculations for membership are ordered from least to most
-   * computationally expensive to compute, so don't reorder them willy-nilly.
-   */
-  std::copy_if(c_absorbable_blocks.begin(),
-               c_absorbable_blocks.end(),
-               std::inserter(absorb_blocks, absorb_blocks.begin()),
-               [&](const auto& pair) {
-                 auto* block = pair.second;
-                 auto status = checker::placement2D(
-                     c_center - cache_dim / 2.0, cache_dim, block);
-
-                 return
-                     /* block overlaps with extent of cache-to-be */
-                     status.x && status.y &&
-                     /* block is not already allocated to cache-to-be */
-                     c_cache_i_blocks.end() == std::find(c_cache_i_blocks.begin(),
-                                                         c_cache_i_blocks.end(),
-                                                         block) &&
-
-                     /* block is not already allocated to another cache-to-be */
-                     !c_alloc_map.contains(block);
-               });
-  return absorb_blocks;
-} /* cache_i_alloc_from_absorbable() */
 
 NS_END(d1, support, argos, fordyca);
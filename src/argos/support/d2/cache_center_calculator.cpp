@@ -23,6 +23,11 @@
  ******************************************************************************/
 #include "fordyca/argos/support/d2/cache_center_calculator.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
 #include "cosm/arena/repr/arena_cache.hpp"
 #include "cosm/ds/cell2D.hpp"
 #include "cosm/foraging/repr/block_cluster.hpp"
@@ -30,6 +35,8 @@
 #include "cosm/repr/sim_block3D.hpp"
 #include "cosm/spatial/conflict_checker.hpp"
 
+#include "fordyca/argos/support/caches/caches_er.hpp"
+
 /*******************************************************************************
  * Namespaces
  ******************************************************************************/
@@ -41,24 +48,57 @@ NS_START(fordyca, argos, support, d2);
 cache_center_calculator::cache_center_calculator(
     cads::arena_grid* const grid,
     const rtypes::spatial_dist& cache_dim,
-    const cads::nest_vectorro& c_nests,
-    const cfds::block3D_cluster_vectorro& c_clusters)
+    const cads::nest_vectorro& c_nests)
     : ER_CLIENT_INIT("fordyca.argos.support.d2.cache_center_calculator"),
       mc_cache_dim(cache_dim),
       mc_nests(c_nests),
-      mc_clusters(c_clusters),
-      m_grid(grid) {}
+      m_grid(grid),
+      m_forbidden(grid->xdsize() * grid->ydsize(), 0) {
+  /*
+   * We need to be sure the center of the new cache is not near the arena
+   * boundaries, in order to avoid all sorts of weird corner cases.
+   */
+  rmath::ranged xbounds(mc_cache_dim.v(), m_grid->xrsize() - mc_cache_dim.v());
+  rmath::ranged ybounds(mc_cache_dim.v(), m_grid->yrsize() - mc_cache_dim.v());
+  for (size_t i = 0; i < m_grid->xdsize(); ++i) {
+    for (size_t j = 0; j < m_grid->ydsize(); ++j) {
+      auto center = cell_center(rmath::vector2z(i, j));
+      if (!xbounds.contains(center.x()) || !ybounds.contains(center.y())) {
+        ++m_forbidden[cell_index(i, j)];
+      }
+    } /* for(j..) */
+  } /* for(i..) */
+
+  for (const auto* nest : mc_nests) {
+    forbidden_update(conflict_cells(nest), 1);
+  } /* for(*nest..) */
+}
 
 /*******************************************************************************
  * Member Functions
  ******************************************************************************/
+void cache_center_calculator::pass_begin(
+    const cfds::block3D_cluster_vectorro& c_clusters) {
+  forbidden_update(m_pass_cells, -1);
+  m_pass_cells.clear();
+
+  m_clusters = c_clusters;
+  for (const auto* clust : m_clusters) {
+    auto cells = conflict_cells(clust);
+    forbidden_update(cells, 1);
+    m_pass_cells.insert(m_pass_cells.end(), cells.begin(), cells.end());
+  } /* for(*clust..) */
+} /* pass_begin() */
+
 boost::optional<rmath::vector2d> cache_center_calculator::operator()(
     const cds::block3D_vectorno& c_cache_i_blocks,
-    const cads::acache_vectorno& c_existing_caches,
-    rmath::rng* rng) const {
-  ER_TRACE("Existing caches: [%s]", rcppsw::to_string(c_existing_caches).c_str());
-  ER_TRACE("Cache_i blocks: [%s]", rcppsw::to_string(c_cache_i_blocks).c_str());
-  ER_TRACE("Block clusters: [%s]", rcppsw::to_string(mc_clusters).c_str());
+    const cads::acache_vectorno& c_existing_caches) {
+  CACHES_ER_TRACE("Existing caches: [%s]",
+                  rcppsw::to_string(c_existing_caches).c_str());
+  CACHES_ER_TRACE("Cache_i blocks: [%s]",
+                  rcppsw::to_string(c_cache_i_blocks).c_str());
+  CACHES_ER_TRACE("Block clusters: [%s]",
+                  rcppsw::to_string(m_clusters).c_str());
   auto sum = std::accumulate(c_cache_i_blocks.begin(),
                              c_cache_i_blocks.end(),
                              rmath::vector2d(),
@@ -67,226 +107,171 @@ boost::optional<rmath::vector2d> cache_center_calculator::operator()(
                              });
 
   /*
-   * After real -> discrete -> real coordinates transformation to the averaged
-   * location of the blocks, we have the location of the LL corner of the cell
-   * that is our guess for the cache center. We need to move it up to the center
-   * of that cell so that all the xspan/yspan calculations come out correct in
-   * all cases.
+   * After the real -> discrete transformation of the averaged location of the
+   * blocks, we have the cell whose center is our guess for the cache center.
    */
-  rmath::vector2d offset(m_grid->resolution().v() / 2.0,
-                         m_grid->resolution().v() / 2.0);
-
-  auto ll =
+  auto guess =
       rmath::dvec2zvec(sum / c_cache_i_blocks.size(), m_grid->resolution().v());
-  rmath::vector2d center =
-      rmath::zvec2dvec(ll, m_grid->resolution().v()) + offset;
+  guess = rmath::vector2z(std::min(guess.x(), m_grid->xdsize() - 1),
+                          std::min(guess.y(), m_grid->ydsize() - 1));
 
-  ER_DEBUG("Guess center=%s", center.to_str().c_str());
+  CACHES_ER_DEBUG("Guess center=%s", cell_center(guess).to_str().c_str());
 
-  /*
-   * Every time we find an overlap we have to re-test EVERYTHING we've already
-   * verified won't overlap with our new cache, because the move we just made in
-   * x or y might have just caused an overlap.
-   */
-  size_t i = 0;
-  while (i++ < kOVERLAP_SEARCH_MAX_TRIES) {
-    ER_TRACE("Begin search pass %zu", i);
-    if (auto new_center = deconflict_loc(c_existing_caches, center, rng)) {
-      center = new_center.get();
-      ER_TRACE("Search pass %zu unsuccessful: center=%s",
-               i,
-               rcppsw::to_string(center).c_str());
-    } else {
-      ER_TRACE("Search pass %zu successful: center=%s",
-               i,
-               rcppsw::to_string(center).c_str());
-      break;
-    }
-  } /* while(i..) */
+  std::vector<std::vector<size_t>> cache_cells;
+  for (const auto* cache : c_existing_caches) {
+    cache_cells.push_back(conflict_cells(cache));
+    forbidden_update(cache_cells.back(), 1);
+  } /* for(*cache..) */
+
+  auto cell = nearest_free_cell(guess);
 
   /*
-   * We have a set # of tries to fiddle with the new cache center, and if we
-   * can't find anything conflict free in that many, bail out.
+   * The existing caches can change between calculations (e.g., a newly created
+   * cache failing verification), so they are not kept in the raster.
    */
-  if (i >= kOVERLAP_SEARCH_MAX_TRIES) {
-    ER_WARN("No conflict-free center found in %zu tries: caches=[%s] blocks=[%s] "
+  for (const auto& cells : cache_cells) {
+    forbidden_update(cells, -1);
+  } /* for(&cells..) */
+
+  if (!cell) {
+    ER_WARN("No conflict-free center found: caches=[%s] blocks=[%s] "
             "clusters=[%s], nests=[%s]",
-            kOVERLAP_SEARCH_MAX_TRIES,
             rcppsw::to_string(c_existing_caches).c_str(),
             rcppsw::to_string(c_cache_i_blocks).c_str(),
-            rcppsw::to_string(mc_clusters).c_str(),
+            rcppsw::to_string(m_clusters).c_str(),
             rcppsw::to_string(mc_nests).c_str());
     return boost::optional<rmath::vector2d>();
   }
 
   /* we found a center! */
+  auto center = cell_center(*cell);
+  CACHES_ER_DEBUG("Conflict-free center=%s", center.to_str().c_str());
   return boost::make_optional(center);
-} /* calc_center() */
+} /* operator()() */
 
-boost::optional<rmath::vector2d> cache_center_calculator::deconflict_loc(
-    const cads::acache_vectorno& c_existing_caches,
-    const rmath::vector2d& c_center,
-    rmath::rng* rng) const {
-  bool conflict = false;
-  rmath::vector2d new_center = c_center;
-
-  /* check arena boundaries */
-  ER_TRACE("Check arena boundaries");
-  if (auto new_loc = deconflict_loc_boundaries(c_center)) {
-    new_center = new_loc.get();
-    conflict = true;
-  }
-
-  /* check nests */
-  for (size_t i = 0; i < mc_nests.size(); ++i) {
-    ER_TRACE("Check nest%d: xspan=%s,yspan=%s",
-             mc_nests[i]->id().v(),
-             rcppsw::to_string(mc_nests[i]->xrspan()).c_str(),
-             rcppsw::to_string(mc_nests[i]->yrspan()).c_str())
-    if (auto new_loc = deconflict_loc_entity(mc_nests[i], c_center, rng)) {
-      new_center = new_loc.get();
-      conflict = true;
-    }
-  } /* for(i..) */
+void cache_center_calculator::reserve(const rmath::vector2d& c_center) {
+  /*
+   * Two caches of the same dimension overlap iff their centers are within a
+   * cache dimension of each other in both X and Y.
+   */
+  auto res = m_grid->resolution().v();
+  auto dim = mc_cache_dim.v();
+  auto clamp = [&](double cell, size_t size) {
+    return std::min(size, static_cast<size_t>(std::max(0.0, cell)));
+  };
+  auto xmin = clamp(std::floor((c_center.x() - dim) / res), m_grid->xdsize());
+  auto ymin = clamp(std::floor((c_center.y() - dim) / res), m_grid->ydsize());
+  auto xmax = clamp(std::ceil((c_center.x() + dim) / res) + 1, m_grid->xdsize());
+  auto ymax = clamp(std::ceil((c_center.y() + dim) / res) + 1, m_grid->ydsize());
 
-  /* check block clusters */
-  for (size_t i = 0; i < mc_clusters.size(); ++i) {
-    ER_TRACE("Check cluster%zu: xspan=%s,yspan=%s",
-             i,
-             rcppsw::to_string(mc_clusters[i]->xrspan()).c_str(),
-             rcppsw::to_string(mc_clusters[i]->yrspan()).c_str())
-    if (auto new_loc = deconflict_loc_entity(mc_clusters[i], c_center, rng)) {
-      new_center = new_loc.get();
-      conflict = true;
-    }
+  std::vector<size_t> cells;
+  for (size_t i = xmin; i < xmax; ++i) {
+    for (size_t j = ymin; j < ymax; ++j) {
+      auto diff = cell_center(rmath::vector2z(i, j)) - c_center;
+      if (std::fabs(diff.x()) <= dim && std::fabs(diff.y()) <= dim) {
+        cells.push_back(cell_index(i, j));
+      }
+    } /* for(j..) */
   } /* for(i..) */
+  forbidden_update(cells, 1);
+  m_pass_cells.insert(m_pass_cells.end(), cells.begin(), cells.end());
+} /* reserve() */
 
-  /* check existing caches */
-  for (size_t j = 0; j < c_existing_caches.size(); ++j) {
-    ER_TRACE("Check cache%zu: xspan=%s,yspan=%s",
-             j,
-             rcppsw::to_string(c_existing_caches[j]->xrspan()).c_str(),
-             rcppsw::to_string(c_existing_caches[j]->yrspan()).c_str())
-    if (auto new_loc =
-            deconflict_loc_entity(c_existing_caches[j], c_center, rng)) {
-      new_center = new_loc.get();
-      conflict = true;
-    }
-  } /* for(j..) */
-
-  return (conflict) ? boost::make_optional(new_center)
-                    : boost::optional<rmath::vector2d>();
-} /* deconflict_loc() */
-
-boost::optional<rmath::vector2d>
-cache_center_calculator::deconflict_loc_boundaries(
-    const rmath::vector2d& c_center) const {
+std::vector<size_t>
+cache_center_calculator::conflict_cells(const crepr::entity2D* ent) const {
   /*
-   * We need to be sure the center of the new cache is not near the arena
-   * boundaries, in order to avoid all sorts of weird corner cases.
+   * Only cells whose centers are within half a cache dimension of the entity
+   * can possibly conflict with it; the exact check for each such cell is done
+   * with the same conflict checker used elsewhere for cache placement.
+   *
+   * The placement2D() function expects the LL anchor of the entity, NOT the
+   * center, so we have to compute that.
    */
-  rmath::ranged xbounds(mc_cache_dim.v(), m_grid->xrsize() - mc_cache_dim.v());
-  rmath::ranged ybounds(mc_cache_dim.v(), m_grid->yrsize() - mc_cache_dim.v());
-  bool conflict = false;
-  rmath::vector2d new_center = c_center;
-
-  if (!xbounds.contains(new_center.x())) {
-    new_center.x(xbounds.wrap_value(new_center.x()));
-    conflict = true;
-    ER_TRACE("Move center=%s -> %s to be within X=%s",
-             rcppsw::to_string(c_center).c_str(),
-             rcppsw::to_string(new_center).c_str(),
-             rcppsw::to_string(xbounds).c_str());
-  }
-
-  if (!ybounds.contains(new_center.y())) {
-    new_center.y(ybounds.wrap_value(new_center.y()));
-    conflict = true;
-    ER_TRACE("Move center=%s -> %s to be within Y=%s",
-             rcppsw::to_string(c_center).c_str(),
-             rcppsw::to_string(new_center).c_str(),
-             rcppsw::to_string(ybounds).c_str());
-  }
-  if (conflict) {
-    ER_ASSERT(new_center.x() <= xbounds.ub() && new_center.x() >= xbounds.lb() &&
-                  new_center.y() <= ybounds.ub() &&
-                  new_center.y() >= ybounds.lb(),
-              "New center=%s violates arena bounds constraints: X=%s,Y=%s",
-              rcppsw::to_string(new_center).c_str(),
-              rcppsw::to_string(xbounds).c_str(),
-              rcppsw::to_string(ybounds).c_str());
-    return boost::make_optional(new_center);
-  }
-  return boost::optional<rmath::vector2d>();
-} /* deconflict_loc_boundaries() */
+  rmath::vector2d cache_dim(mc_cache_dim.v(), mc_cache_dim.v());
+  auto res = m_grid->resolution().v();
+  auto margin = mc_cache_dim.v() / 2.0 + res;
+  auto clamp = [&](double cell, size_t size) {
+    return std::min(size, static_cast<size_t>(std::max(0.0, cell)));
+  };
+  auto xmin = clamp(std::floor((ent->xrspan().lb() - margin) / res),
+                    m_grid->xdsize());
+  auto ymin = clamp(std::floor((ent->yrspan().lb() - margin) / res),
+                    m_grid->ydsize());
+  auto xmax = clamp(std::ceil((ent->xrspan().ub() + margin) / res),
+                    m_grid->xdsize());
+  auto ymax = clamp(std::ceil((ent->yrspan().ub() + margin) / res),
+                    m_grid->ydsize());
 
-boost::optional<rmath::vector2d>
-cache_center_calculator::deconflict_loc_entity(const crepr::entity2D* ent,
-                                               const rmath::vector2d& c_center,
-                                               rmath::rng* rng) const {
-  RCPPSW_UNUSED auto dcenter =
-      rmath::dvec2zvec(c_center, m_grid->resolution().v());
-  auto exc_xspan = ent->xrspan();
-  auto exc_yspan = ent->yrspan();
-  auto newc_xspan = rmath::xspan(c_center, mc_cache_dim.v());
-  auto newc_yspan = rmath::yspan(c_center, mc_cache_dim.v());
+  std::vector<size_t> cells;
+  for (size_t i = xmin; i < xmax; ++i) {
+    for (size_t j = ymin; j < ymax; ++j) {
+      auto center = cell_center(rmath::vector2z(i, j));
+      auto status = cspatial::conflict_checker::placement2D(
+          center - cache_dim / 2.0, cache_dim, ent);
+      if (status.x && status.y) {
+        cells.push_back(cell_index(i, j));
+      }
+    } /* for(j..) */
+  } /* for(i..) */
+  return cells;
+} /* conflict_cells() */
 
-  ER_TRACE("cache: xspan=%s,center=%s/%s ent%d: xspan=%s",
-           rcppsw::to_string(newc_xspan).c_str(),
-           rcppsw::to_string(c_center).c_str(),
-           rcppsw::to_string(dcenter).c_str(),
-           ent->id().v(),
-           rcppsw::to_string(exc_xspan).c_str());
+void cache_center_calculator::forbidden_update(
+    const std::vector<size_t>& c_cells,
+    int delta) {
+  for (auto cell : c_cells) {
+    auto& count = m_forbidden[cell];
+    count = static_cast<uint16_t>(count + delta);
+  } /* for(cell..) */
+} /* forbidden_update() */
 
-  ER_TRACE("cache: yspan=%s,center=%s/%s ent%d: yspan=%s",
-           rcppsw::to_string(newc_yspan).c_str(),
-           rcppsw::to_string(c_center).c_str(),
-           rcppsw::to_string(dcenter).c_str(),
-           ent->id().v(),
-           rcppsw::to_string(exc_yspan).c_str());
+boost::optional<rmath::vector2z> cache_center_calculator::nearest_free_cell(
+    const rmath::vector2z& c_guess) const {
+  auto xsize = static_cast<long>(m_grid->xdsize());
+  auto ysize = static_cast<long>(m_grid->ydsize());
+  auto gx = static_cast<long>(c_guess.x());
+  auto gy = static_cast<long>(c_guess.y());
 
-  rmath::vector2d new_center = c_center;
+  boost::optional<rmath::vector2z> best;
+  long best_dist2 = std::numeric_limits<long>::max();
 
-  /*
-   * We move the cache by units of the grid size when we discover a conflict in
-   * X or Y, in order to preserve having the cache location be on an even
-   * multiple of the grid size, which makes handling creation much easier.
-   */
-  double x_delta =
-      std::copysign(m_grid->resolution().v(), rng->uniform(-1.0, 1.0));
-  double y_delta =
-      std::copysign(m_grid->resolution().v(), rng->uniform(-1.0, 1.0));
+  for (long r = 0; r <= std::max(xsize, ysize); ++r) {
+    /* nothing in this ring or further out can be closer than what we have */
+    if (best && r * r > best_dist2) {
+      break;
+    }
+    for (long dy = -r; dy <= r; ++dy) {
+      /* only the top/bottom rows of the ring are scanned in full */
+      long step = (std::labs(dy) == r) ? 1 : 2 * r;
+      for (long dx = -r; dx <= r; dx += step) {
+        long x = gx + dx;
+        long y = gy + dy;
+        if (x < 0 || x >= xsize || y < 0 || y >= ysize) {
+          continue;
+        }
+        auto cell = rmath::vector2z(static_cast<size_t>(x),
+                                    static_cast<size_t>(y));
+        long dist2 = dx * dx + dy * dy;
+        if (0 == m_forbidden[cell_index(cell.x(), cell.y())] &&
+            dist2 < best_dist2) {
+          best_dist2 = dist2;
+          best = cell;
+        }
+      } /* for(dx..) */
+    } /* for(dy..) */
+  } /* for(r..) */
+  return best;
+} /* nearest_free_cell() */
 
+rmath::vector2d cache_center_calculator::cell_center(
+    const rmath::vector2z& c_cell) const {
   /*
-   * The placement_conflict2D() function expects the LL anchor of the entity,
-   * NOT the center, so we have to compute that.
+   * We need to move the LL corner of the cell up to the center of that cell
+   * so that all the xspan/yspan calculations come out correct in all cases.
    */
-  rmath::vector2d cache_dim(mc_cache_dim.v(), mc_cache_dim.v());
-  auto status = cspatial::conflict_checker::placement2D(
-      c_center - cache_dim / 2.0, cache_dim, ent);
-
-  if (status.x) {
-    ER_TRACE("X conflict: cache xspan=%s,center=%s overlap ent%d: xspan=%s, "
-             "x_delta=%f",
-             rcppsw::to_string(newc_xspan).c_str(),
-             rcppsw::to_string(c_center).c_str(),
-             ent->id().v(),
-             rcppsw::to_string(exc_xspan).c_str(),
-             x_delta);
-    new_center.x(new_center.x() + x_delta);
-  }
-  if (status.y) {
-    ER_TRACE("Y conflict: cache yspan=%s,center=%s overlap ent%d: yspan=%s, "
-             "y_delta=%f",
-             rcppsw::to_string(newc_yspan).c_str(),
-             rcppsw::to_string(c_center).c_str(),
-             ent->id().v(),
-             rcppsw::to_string(exc_yspan).c_str(),
-             y_delta);
-    new_center.y(new_center.y() + y_delta);
-  }
-  return (status.x && status.y) ? boost::make_optional(new_center)
-                                : boost::optional<rmath::vector2d>();
-} /* deconflict_loc_entity() */
+  rmath::vector2d offset(m_grid->resolution().v() / 2.0,
+                         m_grid->resolution().v() / 2.0);
+  return rmath::zvec2dvec(c_cell, m_grid->resolution().v()) + offset;
+} /* cell_center() */
 
 NS_END(d2, support, argos, fordyca);
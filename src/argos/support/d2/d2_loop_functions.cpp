@@ -225,7 +225,7 @@ void d2_loop_functions::cache_handling_init(
   ER_ASSERT(nullptr != cachep && cachep->dynamic.enable,
             "FATAL: Caches not enabled in d2 loop functions");
   m_cache_manager =
-      std::make_unique<dynamic_cache_manager>(cachep, arena_map(), rng());
+      std::make_unique<dynamic_cache_manager>(cachep, arena_map());
   using saa_names = chargos::subsystem::config::xml::saa_names;
   swarm_manager_adaptor::led_medium(saa_names::leds_saa);
   cache_creation_handle(false);
@@ -270,34 +270,66 @@ void d2_loop_functions::pre_step() {
     ndc_uuid_pop();
   };
   cpargos::swarm_iterator::robots<cpal::iteration_order::ekDYNAMIC>(this, cb);
+
+  /*
+   * If asynchronous dynamic cache creation was triggered last timestep, plan it
+   * while robot controllers run, now that nothing else will modify the arena
+   * until the robots interact with it in post_step().
+   */
+  if (m_dynamic_cache_create) {
+    ndc_uuid_push();
+    if (!cache_creation_handle(true)) {
+      ER_WARN("Unable to plan cache creation after block drop(s) in new cache");
+    }
+    m_dynamic_cache_create = false;
+    ndc_uuid_pop();
+  }
 } /* pre_step() */
 
 void d2_loop_functions::post_step(void) {
   ndc_uuid_push();
   argos_swarm_manager::post_step();
+
+  /* Robots are about to modify the arena, so planning must be done */
+  m_cache_manager->creation_await();
   ndc_uuid_pop();
 
   /* Process all robots: environment interactions then collect metrics */
-  auto cb = [&](::argos::CControllableEntity* robot) {
+  auto interact = [&](controller::foraging_controller* controller) {
     ndc_uuid_push();
-    robot_post_step(dynamic_cast<chal::robot&>(robot->GetParent()));
+    robot_interact(controller);
     ndc_uuid_pop();
   };
-  cpargos::swarm_iterator::robots<cpal::iteration_order::ekDYNAMIC>(this, cb);
+  auto collect = [&](controller::foraging_controller* controller) {
+    ndc_uuid_push();
+    robot_metrics_collect(controller);
+    ndc_uuid_pop();
+  };
+  robots_post_step(interact, collect);
 
   ndc_uuid_push();
+  /* Create any caches planned asynchronously during this timestep */
+  cache_creation_commit();
+
   /*
    * Run dynamic cache creation if it was triggered. We don't wan't to run it
    * unconditionally each timestep, because it is VERRRYYYYY expensive to
-   * compute.
+   * compute. If it is asynchronous, it is started in the next pre_step().
    */
-  if (m_dynamic_cache_create) {
+  const auto* cachep = config()->config_get<fascaches::config::caches_config>();
+  if (m_dynamic_cache_create && !cachep->dynamic.async) {
     if (!cache_creation_handle(true)) {
       ER_WARN("Unable to create cache after block drop(s) in new cache");
     }
     m_dynamic_cache_create = false;
   }
 
+  /*
+   * Rebuild the oracle once for all robot interactions this timestep, after
+   * any dynamic caches they triggered have been created.
+   */
+  oracle_refresh();
+
   /* update arena map */
   const auto* collector =
       m_metrics_manager->get<cfmetrics::block_transportee_metrics_collector>(
@@ -353,13 +385,22 @@ void d2_loop_functions::post_step(void) {
 
 void d2_loop_functions::reset(void) {
   ndc_uuid_push();
+  /* planned caches are for blocks that are about to be redistributed */
+  m_cache_manager->creation_abandon();
+  m_dynamic_cache_create = false;
   argos_swarm_manager::reset();
   m_metrics_manager->initialize();
+
+  /* caches from before the reset are gone even if none are created */
+  m_cache_manager->caches_index_update(arena_map()->caches());
   cache_creation_handle(false);
   ndc_uuid_pop();
 }
 
 void d2_loop_functions::destroy(void) {
+  if (nullptr != m_cache_manager) {
+    m_cache_manager->creation_abandon();
+  }
   if (nullptr != m_metrics_manager) {
     m_metrics_manager->finalize();
   }
@@ -392,12 +433,13 @@ void d2_loop_functions::robot_pre_step(chal::robot& robot) {
                                       repr::forager_los>(controller);
   boost::apply_visitor(applicator,
                        m_los_update_map->at(controller->type_index()));
-} /* robot_pre_step() */
 
-void d2_loop_functions::robot_post_step(chal::robot& robot) {
-  auto* controller = dynamic_cast<controller::foraging_controller*>(
-      &robot.GetControllableEntity().GetController());
+  /* Update robot perception from its new LOS, if configured */
+  robot_perception_update(controller);
+} /* robot_pre_step() */
 
+void d2_loop_functions::robot_interact(
+    controller::foraging_controller* const controller) {
   /*
    * Watch the robot interact with its environment after physics have been
    * updated and its controller has run.
@@ -430,19 +472,17 @@ void d2_loop_functions::robot_post_step(chal::robot& robot) {
 
     /*
      * The oracle does not have up-to-date information about all caches in the
-     * arena now that one has been created, so we need to update the oracle in
-     * the middle of processing robots. This is not an issue in d1, because
-     * caches are always created AFTER processing all robots for a timestep.
-     *
-     * It also does not necessarily have up-to-date information about all blocks
-     * in the arena, as a robot could have dropped a block when it aborted its
-     * current task.
+     * arena now that one has been created/depleted, or about all blocks in the
+     * arena, as a robot could have dropped a block when it aborted its current
+     * task. Nothing consumes the oracle while robots are being processed, so
+     * it is rebuilt once after all robots have been processed.
      */
-    if (nullptr != oracle()) {
-      oracle()->update(arena_map());
-    }
+    oracle_invalidate();
   }
+} /* robot_interact() */
 
+void d2_loop_functions::robot_metrics_collect(
+    controller::foraging_controller* const controller) {
   /* get stats from this robot before its state changes */
   auto mapplicator =
       ccops::applicator<controller::foraging_controller,
@@ -458,7 +498,7 @@ void d2_loop_functions::robot_post_step(chal::robot& robot) {
   boost::apply_visitor(mapplicator,
                        m_metric_extractor_map->at(controller->type_index()));
   controller->block_manip_recorder()->reset();
-} /* robot_post_step() */
+} /* robot_metrics_collect() */
 
 bool d2_loop_functions::cache_creation_handle(bool on_drop) {
   const auto* cachep = config()->config_get<fascaches::config::caches_config>();
@@ -476,15 +516,51 @@ bool d2_loop_functions::cache_creation_handle(bool on_drop) {
     .t = timestep()
   };
 
+  /*
+   * Creation on reset/init is always synchronous, as there are no robot
+   * control steps to overlap with.
+   */
+  if (cachep->dynamic.async && on_drop) {
+    return m_cache_manager->create_async(ccp, arena_map()->free_blocks(false));
+  }
   if (auto created =
           m_cache_manager->create(ccp, arena_map()->free_blocks(false))) {
-    arena_map()->caches_add(*created, this);
-    floor()->SetChanged();
+    caches_created_add(*created);
     return true;
   }
   return false;
 } /* cache_creation_handle() */
 
+bool d2_loop_functions::cache_creation_commit(void) {
+  fascaches::create_ro_params ccp = {
+    .current_caches = arena_map()->caches(),
+    .clusters = arena_map()->block_distributor()->block_clustersro(),
+    .t = timestep()
+  };
+  auto created =
+      m_cache_manager->creation_commit(ccp, arena_map()->free_blocks(false));
+
+  /* nothing was planned */
+  if (!created) {
+    return false;
+  }
+  if (created->empty()) {
+    ER_WARN("Unable to create cache after block drop(s) in new cache");
+    return false;
+  }
+  caches_created_add(*created);
+  return true;
+} /* cache_creation_commit() */
+
+void d2_loop_functions::caches_created_add(const cads::acache_vectoro& created) {
+  arena_map()->caches_add(created, this);
+  m_cache_manager->caches_index_update(arena_map()->caches());
+  floor()->SetChanged();
+
+  /* caches planned asynchronously may not be the result of any robot event */
+  oracle_invalidate();
+} /* caches_created_add() */
+
 NS_END(d2, support, argos, fordyca);
 
 using namespace fasd2; // NOLINT
@@ -23,14 +23,19 @@
  ******************************************************************************/
 #include "fordyca/argos/support/d2/dynamic_cache_creator.hpp"
 
+#include <algorithm>
+#include <numeric>
+
 #include "cosm/arena/caching_arena_map.hpp"
 #include "cosm/arena/operations/cache_extent_clear.hpp"
 #include "cosm/arena/repr/arena_cache.hpp"
 #include "cosm/repr/sim_block3D.hpp"
 #include "cosm/spatial/conflict_checker.hpp"
 
+#include "fordyca/argos/support/caches/caches_er.hpp"
 #include "fordyca/argos/support/caches/creation_verifier.hpp"
 #include "fordyca/argos/support/d2/cache_center_calculator.hpp"
+#include "fordyca/ds/spatial_hash.hpp"
 #include "fordyca/events/cell2D_empty.hpp"
 
 /*******************************************************************************
@@ -41,15 +46,15 @@ NS_START(fordyca, argos, support, d2);
 /*******************************************************************************
  * Constructors/Destructor
  ******************************************************************************/
-dynamic_cache_creator::dynamic_cache_creator(const params* const p,
-                                             rmath::rng* rng)
+dynamic_cache_creator::dynamic_cache_creator(const params* const p)
     : base_creator(p->map, p->cache_dim),
       ER_CLIENT_INIT("fordyca.argos.support.d2.dynamic_cache_creator"),
       mc_min_blocks(p->min_blocks),
       mc_min_dist(p->min_dist),
       mc_strict_constraints(p->strict_constraints),
-      m_rng(rng),
-      m_map(p->map) {}
+      mc_audit(p->audit),
+      m_map(p->map),
+      m_calculator(p->calculator) {}
 
 /*******************************************************************************
  * Member Functions
@@ -58,84 +63,133 @@ dynamic_cache_creator::creation_result
 dynamic_cache_creator::create_all(const fascaches::create_ro_params& c_params,
                                   cds::block3D_vectorno&& usable_blocks,
                                   cds::block3D_htno&& absorbable_blocks) {
-  creation_result res;
-
-  ER_DEBUG("Creating caches: min_dist=%f,min_blocks=%u,usable_blocks=[%s] "
-           "(%zu),absorbable_blocks=[%s] (%zu)",
-           mc_min_dist.v(),
-           mc_min_blocks,
-           rcppsw::to_string(usable_blocks).c_str(),
-           usable_blocks.size(),
-           rcppsw::to_string(absorbable_blocks).c_str(),
-           absorbable_blocks.size());
-
   cds::block3D_vectorno all_blocks;
   std::transform(absorbable_blocks.begin(),
                  absorbable_blocks.end(),
                  std::back_inserter(all_blocks),
                  [&](const auto& pair) { return pair.second; });
 
-  for (auto anchor_it = usable_blocks.begin();
-       anchor_it != usable_blocks.end();) {
-    auto cache_i_initial = cache_i_blocks_alloc(usable_blocks, anchor_it);
-    std::advance(anchor_it, cache_i_initial.size());
-    ER_DEBUG("Removed %zu allocated blocks from usable vector",
-             cache_i_initial.size());
+  auto planned = plan_all(
+      c_params, std::move(usable_blocks), std::move(absorbable_blocks));
+  return realize_all(c_params, std::move(planned), all_blocks);
+} /* create_all() */
+
+dynamic_cache_creator::plan_result
+dynamic_cache_creator::plan_all(const fascaches::create_ro_params& c_params,
+                                cds::block3D_vectorno&& usable_blocks,
+                                cds::block3D_htno&& absorbable_blocks) {
+  plan_result res;
+
+  CACHES_ER_DEBUG("Planning caches: min_dist=%f,min_blocks=%u,"
+                  "usable_blocks=[%s] (%zu),absorbable_blocks=[%s] (%zu)",
+                  mc_min_dist.v(),
+                  mc_min_blocks,
+                  rcppsw::to_string(usable_blocks).c_str(),
+                  usable_blocks.size(),
+                  rcppsw::to_string(absorbable_blocks).c_str(),
+                  absorbable_blocks.size());
+
+  /*
+   * Clusters do not change during a creation pass, so they only need to be
+   * rasterized once for cache center calculation.
+   */
+  m_calculator->pass_begin(c_params.clusters);
+
+  for (auto& cache_i_initial : cache_blocks_cluster(usable_blocks)) {
+    CACHES_ER_DEBUG("Allocated %zu blocks from usable vector",
+                    cache_i_initial.size());
     if (cache_i_initial.size() < mc_min_blocks) {
       continue;
     }
 
-    auto cache_i = cache_i_create(
-        c_params, cache_i_initial, absorbable_blocks, &res.created);
-
-    if (cache_i.status) {
-      cads::acache_vectorro sanity_caches;
-      std::transform(res.created.begin(),
-                     res.created.end(),
-                     std::back_inserter(sanity_caches),
-                     [&](const auto& c) { return c.get(); });
-      sanity_caches.push_back(cache_i.cache.get());
-
-      auto verifier = fascaches::creation_verifier(m_map,
-                                                   cache_dim(),
-                                                   mc_strict_constraints);
-      if (!verifier.verify_single(cache_i.cache.get(),
-                                  sanity_caches,
-                                  all_blocks,
-                                  c_params.clusters)) {
-        cache_delete(cache_i);
+    auto plan = cache_i_plan(
+        c_params, cache_i_initial, absorbable_blocks, m_calculator);
+    if (!plan) {
+      ++res.n_discarded;
+      continue;
+    }
+    /*
+     * Subsequent caches must avoid this one, and cannot absorb any of the
+     * blocks it will be created from.
+     */
+    m_calculator->reserve(plan->center);
+    for (auto* block : plan->blocks) {
+      absorbable_blocks.erase(block->id());
+    } /* for(*block..) */
+    res.plans.push_back(std::move(*plan));
+  } /* for(&cache_i_initial..) */
+  return res;
+} /* plan_all() */
+
+dynamic_cache_creator::creation_result
+dynamic_cache_creator::realize_all(const fascaches::create_ro_params& c_params,
+                                   plan_result&& planned,
+                                   const cds::block3D_vectorno& c_all_blocks) {
+  creation_result res;
+  res.n_discarded = planned.n_discarded;
+
+  /*
+   * Each new cache is verified against the caches already created in this
+   * pass incrementally, rather than re-verifying all of them each time.
+   */
+  fascaches::creation_verifier verifier(m_map, cache_dim(), mc_strict_constraints);
+
+  std::vector<cache_i_result> created;
+  for (auto& plan : planned.plans) {
+    if (!cache_i_revalidate(&plan)) {
+      ++res.n_discarded;
+      continue;
+    }
+    auto cache_i = cache_i_create(c_params, std::move(plan));
+
+    if (!verifier.verify_single(
+            cache_i.cache.get(), c_all_blocks, c_params.clusters)) {
+      cache_delete(cache_i, &verifier);
+    } else {
+      created.push_back(std::move(cache_i));
+    }
+  } /* for(&plan..) */
+
+  /*
+   * Periodic full verification of everything created during this pass, as a
+   * check on the incremental verification. With strict constraints, caches
+   * which fail it are discarded, same as if they had failed incremental
+   * verification.
+   */
+  if (!mc_audit) {
+    for (auto& cache_i : created) {
+      res.created.push_back(cache_i.cache);
+    } /* for(&cache_i..) */
+  } else if (!created.empty()) {
+    auto bad = verifier.audit(c_all_blocks, c_params.clusters);
+    if (!bad.empty()) {
+      ER_WARN("%zu/%zu created caches failed audit: strict_constraints=%d",
+              bad.size(),
+              created.size(),
+              mc_strict_constraints);
+    }
+    for (auto& cache_i : created) {
+      if (mc_strict_constraints &&
+          bad.end() != std::find(bad.begin(), bad.end(), cache_i.cache.get())) {
+        cache_delete(cache_i, &verifier);
       } else {
         res.created.push_back(cache_i.cache);
-        /*
-         * Remove all the blocks successfully used during creation from the set
-         * of blocks which can be absorbed as part of subsequent successful
-         * cache creations.
-         */
-        for (auto* block : cache_i.used) {
-          absorbable_blocks.erase(block->id());
-        } /* for(*block..) */
       }
-    } else {
-      ++res.n_discarded;
-    }
-  } /* for(anchor_it..) */
+    } /* for(&cache_i..) */
+  }
   return res;
-} /* create_all() */
+} /* realize_all() */
 
-dynamic_cache_creator::cache_i_result dynamic_cache_creator::cache_i_create(
+boost::optional<dynamic_cache_creator::cache_plan>
+dynamic_cache_creator::cache_i_plan(
     const fascaches::create_ro_params& c_params,
     const cds::block3D_vectorno& c_alloc_blocks,
     const cds::block3D_htno& c_absorbable_blocks,
-    cads::acache_vectoro* created) {
-  cads::acache_vectorno c_avoid =
-      avoidance_caches_calc(c_params.current_caches, *created);
-
+    cache_center_calculator* calculator) const {
   /* First, try find a conflict free cache center (host cell) */
-  auto calculator = cache_center_calculator(
-      &map()->decoratee(), cache_dim(), m_map->nests(), c_params.clusters);
-  auto center = calculator(c_alloc_blocks, c_avoid, m_rng);
+  auto center = (*calculator)(c_alloc_blocks, c_params.current_caches);
   if (!center) {
-    return {};
+    return boost::none;
   }
 
   /*
@@ -145,72 +199,140 @@ dynamic_cache_creator::cache_i_result dynamic_cache_creator::cache_i_create(
    */
   auto absorb_blocks = cache_i_alloc_from_absorbable(
       c_absorbable_blocks, c_alloc_blocks, *center, cache_dim());
-  ER_DEBUG("Absorb blocks=[%s]", rcppsw::to_string(absorb_blocks).c_str());
+  CACHES_ER_DEBUG("Absorb blocks=[%s]",
+                  rcppsw::to_string(absorb_blocks).c_str());
 
   /* blocks for cache i = allocated blocks + absorb blocks */
-  cds::block3D_vectorno cache_i_blocks(c_alloc_blocks.begin(),
-                                       c_alloc_blocks.end());
+  cache_plan plan;
+  plan.center = *center;
+  plan.blocks.assign(c_alloc_blocks.begin(), c_alloc_blocks.end());
   std::transform(absorb_blocks.begin(),
                  absorb_blocks.end(),
-                 std::back_inserter(cache_i_blocks),
+                 std::back_inserter(plan.blocks),
                  [&](const auto& pair) { return pair.second; });
+  for (const auto* block : plan.blocks) {
+    plan.anchors.push_back(block->danchor2D());
+  } /* for(*block..) */
 
-  ER_DEBUG("Cache blocks=[%s]", rcppsw::to_string(cache_i_blocks).c_str());
+  CACHES_ER_DEBUG("Cache blocks=[%s]", rcppsw::to_string(plan.blocks).c_str());
+  return boost::make_optional(std::move(plan));
+} /* cache_i_plan() */
 
-  auto cache =
-      create_single_cache(*center, std::move(cache_i_blocks), c_params.t, false);
-  return { true, std::move(cache), cache_i_blocks };
-} /* cache_i_create() */
+bool dynamic_cache_creator::cache_i_revalidate(cache_plan* const plan) const {
+  size_t n_kept = 0;
+  for (size_t i = 0; i < plan->blocks.size(); ++i) {
+    auto* block = plan->blocks[i];
+    if (block->is_carried_by_robot() || block->danchor2D() != plan->anchors[i]) {
+      CACHES_ER_DEBUG("Block%d picked up/moved since cache@%s was planned",
+                      block->id().v(),
+                      plan->center.to_str().c_str());
+      continue;
+    }
+    plan->anchors[n_kept] = plan->anchors[i];
+    plan->blocks[n_kept++] = block;
+  } /* for(i..) */
+  plan->blocks.resize(n_kept);
+  plan->anchors.resize(n_kept);
+  return n_kept >= mc_min_blocks;
+} /* cache_i_revalidate() */
 
-cds::block3D_vectorno dynamic_cache_creator::cache_i_blocks_alloc(
-    const cds::block3D_vectorno& c_usable_blocks,
-    cds::block3D_vectorno::iterator anchor_it) const {
-  cds::block3D_vectorno cache_i_blocks;
+dynamic_cache_creator::cache_i_result dynamic_cache_creator::cache_i_create(
+    const fascaches::create_ro_params& c_params,
+    cache_plan&& plan) {
+  cds::block3D_vectorno cache_i_blocks(std::move(plan.blocks));
+  auto cache = create_single_cache(
+      plan.center, std::move(cache_i_blocks), c_params.t, false);
+  return { std::move(cache), cache_i_blocks };
+} /* cache_i_create() */
 
+std::vector<cds::block3D_vectorno> dynamic_cache_creator::cache_blocks_cluster(
+    const cds::block3D_vectorno& c_usable_blocks) const {
   /*
-   * No usable blocks left, or our anchor block has already been used.
+   * Bucket blocks by location at the resolution of the minimum distance, so
+   * that only blocks in neighboring buckets need to be checked against each
+   * block, rather than all other blocks.
    */
-  if (c_usable_blocks.empty() || c_usable_blocks.end() == anchor_it) {
-    return {};
-  }
+  fds::spatial_hash<size_t> hash(mc_min_dist);
+  for (size_t i = 0; i < c_usable_blocks.size(); ++i) {
+    hash.insert(c_usable_blocks[i]->rcenter2D(), i);
+  } /* for(i..) */
 
   /*
-   * Add our anchor/target block to the list of blocks for the new cache. This
-   * is OK to do even if there are no other blocks close enough to create a new
-   * cache, because we have a minimum # blocks threshold that has to be met
-   * anyway.
+   * Single-linkage clustering: any two blocks within the minimum distance of
+   * each other end up in the same cluster, unless that would make the cluster
+   * span more than the cache dimension or the minimum distance (whichever is
+   * larger) in X or Y. Otherwise a dense stretch of blocks could be chained
+   * into a single arbitrarily large cluster, and therefore cache. Each cluster
+   * is rooted at its lowest index block, so that clusters come out in the same
+   * order as the usable blocks.
    */
-  ER_TRACE("Add anchor block%d@%s/%s to src list",
-           (*anchor_it)->id().v(),
-           rcppsw::to_string((*anchor_it)->ranchor2D()).c_str(),
-           rcppsw::to_string((*anchor_it)->danchor2D()).c_str());
-  cache_i_blocks.push_back(*anchor_it);
-
-  ++anchor_it;
-  while (anchor_it != c_usable_blocks.end()) {
-    auto* candidate = *anchor_it;
-    ++anchor_it;
-    /*
-     * If we find a block that is close enough to our anchor/target block, then
-     * add to the src list.
-     */
-    rtypes::spatial_dist to_block(
-        (candidate->rcenter2D() - candidate->rcenter2D()).length());
-    if (to_block <= mc_min_dist) {
-      ER_ASSERT(std::find(cache_i_blocks.begin(),
-                          cache_i_blocks.end(),
-                          candidate) == cache_i_blocks.end(),
-                "Block%d already on src list",
-                candidate->id().v());
-      ER_TRACE("Add block%d@%s/%s to src list",
-               candidate->id().v(),
-               rcppsw::to_string(candidate->ranchor2D()).c_str(),
-               rcppsw::to_string(candidate->danchor2D()).c_str());
-      cache_i_blocks.push_back(candidate);
+  auto max_extent = std::max(cache_dim().v(), mc_min_dist.v());
+  std::vector<size_t> parent(c_usable_blocks.size());
+  std::iota(parent.begin(), parent.end(), 0);
+
+  /* bounding box of the centers of the blocks in each cluster, by root */
+  std::vector<rmath::vector2d> lls;
+  std::vector<rmath::vector2d> urs;
+  for (const auto* block : c_usable_blocks) {
+    lls.push_back(block->rcenter2D());
+    urs.push_back(block->rcenter2D());
+  } /* for(*block..) */
+  auto root = [&](size_t i) {
+    while (parent[i] != i) {
+      parent[i] = parent[parent[i]];
+      i = parent[i];
+    } /* while() */
+    return i;
+  };
+
+  for (size_t i = 0; i < c_usable_blocks.size(); ++i) {
+    const auto* block = c_usable_blocks[i];
+    hash.query(block->rcenter2D(), mc_min_dist, [&](size_t j) {
+      /* each pair only needs to be checked once */
+      if (j >= i) {
+        return;
+      }
+      rtypes::spatial_dist to_block(
+          (block->rcenter2D() - c_usable_blocks[j]->rcenter2D()).length());
+      if (to_block > mc_min_dist) {
+        return;
+      }
+      size_t root_i = root(i);
+      size_t root_j = root(j);
+      if (root_i == root_j) {
+        return;
+      }
+      rmath::vector2d ll(std::min(lls[root_i].x(), lls[root_j].x()),
+                         std::min(lls[root_i].y(), lls[root_j].y()));
+      rmath::vector2d ur(std::max(urs[root_i].x(), urs[root_j].x()),
+                         std::max(urs[root_i].y(), urs[root_j].y()));
+      if (ur.x() - ll.x() > max_extent || ur.y() - ll.y() > max_extent) {
+        return;
+      }
+      size_t merged = std::min(root_i, root_j);
+      parent[std::max(root_i, root_j)] = merged;
+      lls[merged] = ll;
+      urs[merged] = ur;
+    });
+  } /* for(i..) */
+
+  std::vector<cds::block3D_vectorno> clusters;
+  std::vector<size_t> cluster_index(c_usable_blocks.size());
+  for (size_t i = 0; i < c_usable_blocks.size(); ++i) {
+    size_t r = root(i);
+    if (r == i) {
+      cluster_index[i] = clusters.size();
+      clusters.emplace_back();
     }
-  } /* while() */
-  return cache_i_blocks;
-} /* cache_i_blocks_alloc() */
+    CACHES_ER_TRACE("Add block%d@%s/%s to src list for cluster%zu",
+                    c_usable_blocks[i]->id().v(),
+                    rcppsw::to_string(c_usable_blocks[i]->ranchor2D()).c_str(),
+                    rcppsw::to_string(c_usable_blocks[i]->danchor2D()).c_str(),
+                    cluster_index[r]);
+    clusters[cluster_index[r]].push_back(c_usable_blocks[i]);
+  } /* for(i..) */
+  return clusters;
+} /* cache_blocks_cluster() */
 
 cds::block3D_htno dynamic_cache_creator::cache_i_alloc_from_absorbable(
     const cds::block3D_htno& c_absorbable_blocks,
@@ -240,18 +362,10 @@ cds::block3D_htno dynamic_cache_creator::cache_i_alloc_from_absorbable(
   return absorb_blocks;
 } /* cache_i_alloc_from_absorbable() */
 
-cads::acache_vectorno dynamic_cache_creator::avoidance_caches_calc(
-    const cads::acache_vectorno& c_previous_caches,
-    const cads::acache_vectoro& c_created_caches) const {
-  cads::acache_vectorno avoid = c_previous_caches;
-  for (const auto& c : c_created_caches) {
-    avoid.push_back(c.get());
-  } /* for(&c..) */
-  return avoid;
-} /* avoidance_caches_calc() */
-
-void dynamic_cache_creator::cache_delete(const cache_i_result& cache_i) {
-  ER_INFO("Delete (badly) created cache%d", cache_i.cache->id().v());
+void dynamic_cache_creator::cache_delete(
+    const cache_i_result& cache_i,
+    fascaches::creation_verifier* const verifier) {
+  CACHES_ER_INFO("Delete (badly) created cache%d", cache_i.cache->id().v());
 
   /*
    * Clear out cache host cell. Note that we STILL need to clear the
@@ -274,6 +388,7 @@ void dynamic_cache_creator::cache_delete(const cache_i_result& cache_i) {
      * context.
      */
     m_map->distribute_single_block(b, carena::locking::ekALL_HELD);
+    verifier->block_relocated(b);
   } /* for(*b..) */
 } /* cache_delete() */
 
@@ -27,7 +27,6 @@
 #include "cosm/foraging/repr/block_cluster.hpp"
 #include "cosm/repr/sim_block3D.hpp"
 
-#include "fordyca/argos/support/d2/dynamic_cache_creator.hpp"
 #include "fordyca/events/cell2D_empty.hpp"
 
 /*******************************************************************************
@@ -40,12 +39,13 @@ NS_START(fordyca, argos, support, d2);
  ******************************************************************************/
 dynamic_cache_manager::dynamic_cache_manager(
     const fascaches::config::caches_config* config,
-    carena::caching_arena_map* arena_map,
-    rmath::rng* rng)
+    carena::caching_arena_map* arena_map)
     : base_manager(config, arena_map),
       ER_CLIENT_INIT("fordyca.argos.support.d2.dynamic_cache_manager"),
-      m_rng(rng),
-      m_map(arena_map) {}
+      m_map(arena_map),
+      m_calculator(&arena_map->decoratee(),
+                   cache_dim_calc(),
+                   arena_map->nests()) {}
 
 /*******************************************************************************
  * Member Functions
@@ -53,53 +53,148 @@ dynamic_cache_manager::dynamic_cache_manager(
 boost::optional<cads::acache_vectoro>
 dynamic_cache_manager::create(const fascaches::create_ro_params& c_params,
                               const cds::block3D_vectorno& c_all_blocks) {
+  ER_ASSERT(!m_planning.valid() && !m_planned,
+            "Cache creation already in progress");
   auto usable_cb = std::bind(&dynamic_cache_manager::block_alloc_usable_filter,
                              this,
                              std::placeholders::_1,
-                             std::placeholders::_2,
-                             std::placeholders::_3);
+                             std::placeholders::_2);
   auto absorbable_cb =
       std::bind(&dynamic_cache_manager::block_alloc_absorbable_filter,
                 this,
                 std::placeholders::_1,
-                std::placeholders::_2,
-                std::placeholders::_3);
+                std::placeholders::_2);
   if (auto for_creation = creation_blocks_alloc(c_all_blocks,
                                                 c_params.current_caches,
                                                 c_params.clusters,
                                                 usable_cb,
                                                 absorbable_cb)) {
-    support::d2::dynamic_cache_creator::params params = {
-      .map = m_map,
-      .cache_dim = cache_dim_calc(),
-      .min_dist = config()->dynamic.min_dist,
-      .min_blocks = config()->dynamic.min_blocks,
-      .strict_constraints = config()->strict_constraints
-    };
-    support::d2::dynamic_cache_creator creator(&params, m_rng);
+    auto params = creator_params();
+    support::d2::dynamic_cache_creator creator(&params);
 
     auto res = creator.create_all(c_params,
                                   std::move(for_creation->usable),
                                   std::move(for_creation->absorbable));
-    caches_created(res.created.size());
-    caches_discarded(res.n_discarded);
+    return creation_finish(&creator, std::move(res));
+  } else {
+    return boost::optional<cads::acache_vectoro>();
+  }
+} /* create() */
 
-    /* Configure cache extents */
-    creator.cache_extents_configure(res.created);
+bool dynamic_cache_manager::create_async(
+    const fascaches::create_ro_params& c_params,
+    const cds::block3D_vectorno& c_all_blocks) {
+  ER_ASSERT(!m_planning.valid() && !m_planned,
+            "Cache creation already in progress");
+  auto usable_cb = std::bind(&dynamic_cache_manager::block_alloc_usable_filter,
+                             this,
+                             std::placeholders::_1,
+                             std::placeholders::_2);
+  auto absorbable_cb =
+      std::bind(&dynamic_cache_manager::block_alloc_absorbable_filter,
+                this,
+                std::placeholders::_1,
+                std::placeholders::_2);
+  auto for_creation = creation_blocks_alloc(c_all_blocks,
+                                            c_params.current_caches,
+                                            c_params.clusters,
+                                            usable_cb,
+                                            absorbable_cb);
+  if (!for_creation) {
+    return false;
+  }
 
-    /* update bloctree */
-    bloctree_update(res.created);
+  /*
+   * Everything the planner needs is copied into the task, since it runs while
+   * the caller goes on to do other things. The cache center calculator is
+   * shared with the task, which is OK because only one creation pass can be in
+   * progress at a time.
+   */
+  m_planning = std::async(
+      std::launch::async,
+      [params = creator_params(),
+       c_params,
+       usable = std::move(for_creation->usable),
+       absorbable = std::move(for_creation->absorbable)]() mutable {
+        support::d2::dynamic_cache_creator creator(&params);
+        return creator.plan_all(
+            c_params, std::move(usable), std::move(absorbable));
+      });
+  return true;
+} /* create_async() */
 
-    return boost::make_optional(res.created);
-  } else {
+void dynamic_cache_manager::creation_await(void) {
+  if (m_planning.valid()) {
+    m_planned = m_planning.get();
+  }
+} /* creation_await() */
+
+void dynamic_cache_manager::creation_abandon(void) {
+  creation_await();
+  m_planned.reset();
+} /* creation_abandon() */
+
+boost::optional<cads::acache_vectoro>
+dynamic_cache_manager::creation_commit(
+    const fascaches::create_ro_params& c_params,
+    const cds::block3D_vectorno& c_all_blocks) {
+  creation_await();
+  if (!m_planned) {
     return boost::optional<cads::acache_vectoro>();
   }
-} /* create() */
+  auto planned = std::move(*m_planned);
+  m_planned.reset();
+
+  /*
+   * Blocks may have been picked up/dropped since planning, so the free blocks
+   * to verify the created caches against need to be recomputed.
+   */
+  auto membership =
+      block_membership_calc(c_params.current_caches, c_params.clusters);
+  cds::block3D_vectorno free_blocks;
+  std::copy_if(c_all_blocks.begin(),
+               c_all_blocks.end(),
+               std::back_inserter(free_blocks),
+               [&](const auto* block) {
+                 return block_alloc_absorbable_filter(block, membership);
+               });
+
+  auto params = creator_params();
+  support::d2::dynamic_cache_creator creator(&params);
+  auto res = creator.realize_all(c_params, std::move(planned), free_blocks);
+  return creation_finish(&creator, std::move(res));
+} /* creation_commit() */
+
+dynamic_cache_creator::params dynamic_cache_manager::creator_params(void) {
+  return { .map = m_map,
+           .cache_dim = cache_dim_calc(),
+           .min_dist = config()->dynamic.min_dist,
+           .min_blocks = config()->dynamic.min_blocks,
+           .strict_constraints = config()->strict_constraints,
+           .audit = config()->dynamic.audit_interval > 0 &&
+                    0 == (m_n_passes + 1) % config()->dynamic.audit_interval,
+           .calculator = &m_calculator };
+} /* creator_params() */
+
+boost::optional<cads::acache_vectoro> dynamic_cache_manager::creation_finish(
+    dynamic_cache_creator* const creator,
+    dynamic_cache_creator::creation_result&& res) {
+  caches_created(res.created.size());
+  caches_discarded(res.n_discarded);
+  ++m_n_passes;
+
+  /* Configure cache extents */
+  creator->cache_extents_configure(res.created);
+
+  /* update bloctree */
+  bloctree_update(res.created);
+
+  return boost::make_optional(std::move(res.created));
+} /* creation_finish() */
 
 bool dynamic_cache_manager::block_alloc_usable_filter(
     const crepr::sim_block3D* block,
-    const cads::acache_vectorno& existing_caches,
-    const cfds::block3D_cluster_vectorro& clusters) {
+    const block_membership& membership) const {
   /*
    * Initial allocation.
    *
@@ -111,31 +206,19 @@ bool dynamic_cache_manager::block_alloc_usable_filter(
       !block->is_carried_by_robot() &&
 
       /* blocks cannot be in existing caches */
-      std::all_of(existing_caches.begin(),
-                  existing_caches.end(),
-                  [&](const auto& c) { return !c->contains_block(block); }) &&
+      !membership.cache.count(block->id().v()) &&
 
       /* blocks cannot be in clusters */
-      std::all_of(clusters.begin(), clusters.end(), [&](const auto& clust) {
-        /* constructed, so must assign before search */
-        auto cblocks = clust->blocks();
-        ER_DEBUG("Cluster%d blocks: [%s]",
-                 clust->id().v(),
-                 rcppsw::to_string(cblocks).c_str());
-        return cblocks.end() == std::find(cblocks.begin(), cblocks.end(), block);
-      });
+      !membership.cluster.count(block->id().v());
 } /* block_alloc_usable_filter() */
 
 bool dynamic_cache_manager::block_alloc_absorbable_filter(
     const crepr::sim_block3D* block,
-    const cads::acache_vectorno& existing_caches,
-    const cfds::block3D_cluster_vectorro&) {
+    const block_membership& membership) const {
   /* blocks cannot be carried by a robot */
   return !block->is_carried_by_robot() &&
          /* Blocks cannot be in existing caches */
-         std::all_of(existing_caches.begin(),
-                     existing_caches.end(),
-                     [&](const auto& c) { return !c->contains_block(block); });
+         !membership.cache.count(block->id().v());
 } /* block_alloc_absorbable_filter() */
 
 NS_END(d2, support, argos, fordyca);
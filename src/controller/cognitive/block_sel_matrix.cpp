@@ -39,6 +39,14 @@ block_sel_matrix::block_sel_matrix(
   this->insert(std::make_pair(kRampPriority, config->priorities.ramp));
   this->insert(std::make_pair(kSelExceptions, std::vector<rtypes::type_uuid>()));
   this->insert(std::make_pair(kPickupPolicy, config->pickup_policy));
+
+  m_fields.nest_loc = nest_loc;
+  m_fields.cube_priority = config->priorities.cube;
+  m_fields.ramp_priority = config->priorities.ramp;
+  m_fields.pickup_policy = config->pickup_policy;
+  if (kPickupPolicyClusterProx == config->pickup_policy.policy) {
+    m_fields.pickup_type = block_sel_fields::ekPICKUP_POLICY_CLUSTER_PROX;
+  }
 }
 
 /*******************************************************************************
@@ -47,11 +55,13 @@ block_sel_matrix::block_sel_matrix(
 void block_sel_matrix::sel_exception_add(const rtypes::type_uuid& id) {
   std::get<std::vector<rtypes::type_uuid>>(this->find(kSelExceptions)->second)
       .push_back(id);
+  m_fields.sel_exceptions.add(id);
 } /* sel_exception_add() */
 
 void block_sel_matrix::sel_exceptions_clear(void) {
   std::get<std::vector<rtypes::type_uuid>>(this->operator[](kSelExceptions))
       .clear();
+  m_fields.sel_exceptions.clear();
 } /* sel_exceptions_clear() */
 
 NS_END(cognitive, controller, fordyca);
@@ -23,16 +23,16 @@
  ******************************************************************************/
 #include "fordyca/controller/cognitive/block_selector.hpp"
 
+#include <vector>
+
 #include "cosm/repr/base_block3D.hpp"
 
-#include "fordyca/math/block_utility.hpp"
 #include "fordyca/subsystem/perception/ds/dp_block_map.hpp"
 
 /*******************************************************************************
  * Namespaces
  ******************************************************************************/
 NS_START(fordyca, controller, cognitive);
-using bselm = block_sel_matrix;
 
 /*******************************************************************************
  * Constructors/Destructor
@@ -46,48 +46,39 @@ block_selector::block_selector(const block_sel_matrix* const sel_matrix)
  ******************************************************************************/
 const crepr::base_block3D*
 block_selector::operator()(const fspds::dp_block_map& blocks,
-                           const rmath::vector2d& position) {
-  double max_utility = 0.0;
-  const crepr::base_block3D* best = nullptr;
-
+                           const rmath::vector2d& position) const {
   ER_ASSERT(!blocks.empty(), "No known perceived blocks");
-  for (const auto& b : blocks.values_range()) {
-    if (block_is_excluded(position, b.ent())) {
-      continue;
-    }
 
+  m_candidates.clear();
+  m_candidates.reserve(blocks.size());
+  m_batch.reset(blocks.size());
+
+  for (const auto& b : blocks.values_range()) {
     /*
      * Only two options for right now: cube blocks or ramp blocks. This will
      * undoubtedly have to change in the future.
      */
-    double priority =
-        (crepr::block_type::ekCUBE == b.ent()->md()->type())
-            ? std::get<double>(mc_matrix->find(bselm::kCubePriority)->second)
-            : std::get<double>(mc_matrix->find(bselm::kRampPriority)->second);
-    rmath::vector2d nest_loc =
-        std::get<rmath::vector2d>(mc_matrix->find(bselm::kNestLoc)->second);
-
-    double utility = math::block_utility(b.ent()->ranchor2D(), nest_loc)(
-        position, b.density(), priority);
-
-    ER_DEBUG("Utility for block%d@%s/%s, density=%f: %f",
-             b.ent()->id().v(),
-             rcppsw::to_string(b.ent()->ranchor2D()).c_str(),
-             rcppsw::to_string(b.ent()->danchor2D()).c_str(),
-             b.density().v(),
-             utility);
-    if (utility > max_utility) {
-      best = b.ent();
-      max_utility = utility;
-    }
+    double priority = (crepr::block_type::ekCUBE == b.ent()->md()->type())
+                          ? mc_matrix->fields().cube_priority
+                          : mc_matrix->fields().ramp_priority;
+    m_batch.add(b.ent()->ranchor2D(),
+                b.density(),
+                priority,
+                !block_is_excluded(position, b.ent()));
+    m_candidates.push_back(b.ent());
   } /* for(block..) */
 
-  ER_CONDI(nullptr != best,
-           "Best utility: block%d@%s/%s: %f",
-           best->id().v(),
-           rcppsw::to_string(best->ranchor2D()).c_str(),
-           rcppsw::to_string(best->danchor2D()).c_str(),
-           max_utility);
+  m_batch.block_utilities_calc(position, mc_matrix->fields().nest_loc);
+
+  const crepr::base_block3D* best = nullptr;
+  if (auto idx = m_batch.best()) {
+    best = m_candidates[*idx];
+    ER_INFO("Best utility: block%d@%s/%s: %f",
+            best->id().v(),
+            rcppsw::to_string(best->ranchor2D()).c_str(),
+            rcppsw::to_string(best->danchor2D()).c_str(),
+            m_batch.utility(*idx));
+  }
 
   ER_CONDW(nullptr == best, "No best block found: all known blocks excluded!");
   return best;
@@ -110,11 +101,7 @@ bool block_selector::block_is_excluded(
              block_dim);
     return true;
   }
-  auto exceptions = std::get<std::vector<rtypes::type_uuid>>(
-      mc_matrix->find(bselm::kSelExceptions)->second);
-  if (std::any_of(exceptions.begin(), exceptions.end(), [&](auto& id) {
-        return id == block->id();
-      })) {
+  if (mc_matrix->fields().sel_exceptions.contains(block->id())) {
     ER_DEBUG("Ignoring block%d@%s/%s: On exception list",
              block->id().v(),
              block->ranchor2D().to_str().c_str(),
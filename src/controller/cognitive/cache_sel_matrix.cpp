@@ -48,6 +48,25 @@ cache_sel_matrix::cache_sel_matrix(
   this->insert(std::make_pair(kPickupPolicy, config->pickup_policy));
   this->insert(std::make_pair(kStrictConstraints, config->strict_constraints));
   this->insert(std::make_pair(kNewCacheDropTolerance, config->new_cache_tol));
+
+  m_fields.nest_loc = nest_loc;
+  m_fields.cache_prox_dist = config->cache_prox_dist;
+  m_fields.block_prox_dist = config->block_prox_dist;
+  m_fields.nest_prox_dist = config->nest_prox_dist;
+  m_fields.cluster_prox_dist = config->nest_prox_dist;
+  m_fields.site_xrange = config->site_xrange;
+  m_fields.site_yrange = config->site_yrange;
+  m_fields.pickup_policy = config->pickup_policy;
+  m_fields.strict_constraints = config->strict_constraints;
+  m_fields.new_cache_tol = config->new_cache_tol;
+
+  if (kPickupPolicyTime == config->pickup_policy.policy) {
+    m_fields.pickup_type = cache_sel_fields::ekPICKUP_POLICY_TIME;
+  } else if (kPickupPolicyCacheSize == config->pickup_policy.policy) {
+    m_fields.pickup_type = cache_sel_fields::ekPICKUP_POLICY_CACHE_SIZE;
+  } else if (kPickupPolicyCacheDuration == config->pickup_policy.policy) {
+    m_fields.pickup_type = cache_sel_fields::ekPICKUP_POLICY_CACHE_DURATION;
+  }
 }
 
 /*******************************************************************************
@@ -59,11 +78,13 @@ void cache_sel_matrix::sel_exception_add(const cache_sel_exception& ex) {
       auto& vec = std::get<std::vector<rtypes::type_uuid>>(
           this->find(kPickupExceptions)->second);
       vec.push_back(ex.id);
+      m_fields.pickup_exceptions.add(ex.id);
     } break;
     case cache_sel_exception::ekDROP: {
       auto& vec = std::get<std::vector<rtypes::type_uuid>>(
           this->find(kDropExceptions)->second);
       vec.push_back(ex.id);
+      m_fields.drop_exceptions.add(ex.id);
     } break;
     default:
       ER_FATAL_SENTINEL("Bad exception type %d", ex.type);
@@ -73,6 +94,8 @@ void cache_sel_matrix::sel_exception_add(const cache_sel_exception& ex) {
 void cache_sel_matrix::sel_exceptions_clear(void) {
   std::get<std::vector<rtypes::type_uuid>>(this->at(kPickupExceptions)).clear();
   std::get<std::vector<rtypes::type_uuid>>(this->at(kDropExceptions)).clear();
+  m_fields.pickup_exceptions.clear();
+  m_fields.drop_exceptions.clear();
 } /* sel_exceptions_clear() */
 
 NS_END(cognitive, controller, fordyca);
@@ -49,6 +49,10 @@ void cognitive_controller::perception(
   m_perception = std::move(perception);
 }
 
+void cognitive_controller::perception_update(void) {
+  m_perception->update(nullptr);
+} /* perception_update() */
+
 double cognitive_controller::los_dim(void) const {
   return perception()->los_dim();
 } /* los_dim() */
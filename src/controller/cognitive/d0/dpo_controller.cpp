@@ -84,7 +84,9 @@ void dpo_controller::control_step(void) {
             block()->md()->robot_id().v());
 
   /* Update perception */
-  perception()->update(nullptr);
+  if (!perception_external()) {
+    perception_update();
+  }
 
   /*
    * Run the FSM and apply steering forces if normal operation, otherwise handle
@@ -130,7 +132,8 @@ void dpo_controller::shared_init(
 
   /* DPO perception subsystem */
   auto factory = fsperception::perception_subsystem_factory();
-  perception(factory.create(perception_config->type, perception_config));
+  perception(
+      factory.create(perception_config->type, perception_config, rng()));
 
   /* block selection matrix */
   m_block_sel_matrix =
@@ -70,7 +70,9 @@ void mdpo_controller::control_step(void) {
    */
   saa()->steer_force2D().tracking_reset();
 
-  perception()->update(nullptr);
+  if (!perception_external()) {
+    perception_update();
+  }
 
   /*
    * Run the FSM and apply steering forces if normal operation, otherwise handle
@@ -121,7 +123,7 @@ void mdpo_controller::shared_init(
                           p.mdpo.rlos.grid2D.resolution.v() * 5);
   p.mdpo.rlos.grid2D.dims += padding;
   auto factory = fsperception::perception_subsystem_factory();
-  perception(factory.create(p.type, &p));
+  perception(factory.create(p.type, &p, rng()));
 } /* shared_init() */
 
 void mdpo_controller::private_init(
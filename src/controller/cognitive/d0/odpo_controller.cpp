@@ -50,6 +50,10 @@ odpo_controller::~odpo_controller(void) = default;
 /*******************************************************************************
  * Member Functions
  ******************************************************************************/
+void odpo_controller::perception_update(void) {
+  perception()->update(m_receptor.get());
+} /* perception_update() */
+
 void odpo_controller::control_step(void) {
   mdc_ts_update();
   ndc_uuid_push();
@@ -59,7 +63,9 @@ void odpo_controller::control_step(void) {
             block()->id().v(),
             block()->md()->robot_id().v());
 
-  perception()->update(m_receptor.get());
+  if (!perception_external()) {
+    perception_update();
+  }
 
   /*
    * Reset steering forces tracking so per-timestep visualizations are
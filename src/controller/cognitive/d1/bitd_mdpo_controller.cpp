@@ -77,7 +77,9 @@ void bitd_mdpo_controller::control_step(void) {
             block()->id().v(),
             block()->md()->robot_id().v());
 
-  perception()->update(nullptr);
+  if (!perception_external()) {
+    perception_update();
+  }
 
   /*
    * Reset steering forces tracking so per-timestep visualizations are
@@ -111,7 +113,7 @@ void bitd_mdpo_controller::shared_init(
   p.mdpo.rlos.grid2D.dims += padding;
 
   auto factory = fsperception::perception_subsystem_factory();
-  perception(factory.create(p.type, &p));
+  perception(factory.create(p.type, &p, rng()));
 
   /*
    * Task executive. Even though we use the same executive as the \ref
@@ -137,7 +137,7 @@ void cache_found::visit(fspds::dpo_store& store) {
   auto it = blocks.begin();
   while (it != blocks.end()) {
     if (m_cache->contains_point((*it)->rcenter2D())) {
-      crepr::sim_block3D* tmp = (*it);
+      const crepr::sim_block3D* tmp = (*it);
       ++it;
       ER_TRACE("Remove block%d hidden behind cache%d",
                tmp->id().v(),
@@ -182,8 +182,7 @@ void cache_found::visit(cds::cell2D& cell) {
 
 void cache_found::visit(fspds::dpo_semantic_map& map) {
   cds::cell2D& cell = map.access<fspds::occupancy_grid::kCell>(x(), y());
-  crepr::pheromone_density& density =
-      map.access<fspds::occupancy_grid::kPheromone>(x(), y());
+  crepr::pheromone_density& density = map.pheromone(x(), y());
   if (!cell.state_is_known()) {
     map.known_cells_inc();
     ER_ASSERT(map.known_cell_count() <= map.xdsize() * map.ydsize(),
@@ -203,7 +202,7 @@ void cache_found::visit(fspds::dpo_semantic_map& map) {
    * created. When we return to the arena and find a new cache there, we are
    * tracking blocks that no longer exist in our perception.
    */
-  std::vector<crepr::sim_block3D*> rms;
+  std::vector<const crepr::sim_block3D*> rms;
   auto blocks = map.known_blocks();
   for (auto&& b : blocks) {
     if (m_cache->contains_point(b->rcenter2D())) {
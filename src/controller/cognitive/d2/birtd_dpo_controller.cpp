@@ -61,8 +61,9 @@ void birtd_dpo_controller::control_step(void) {
             block()->id().v(),
             block()->md()->robot_id().v());
 
-  /* non-oracular controller */
-  perception()->update(nullptr);
+  if (!perception_external()) {
+    perception_update();
+  }
 
   /*
    * Reset steering forces tracking so per-timestep visualizations are
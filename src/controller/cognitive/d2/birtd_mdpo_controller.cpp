@@ -79,7 +79,7 @@ void birtd_mdpo_controller::shared_init(
   p.mdpo.rlos.grid2D.dims += padding;
 
   auto factory = fsperception::perception_subsystem_factory();
-  perception(factory.create(p.type, &p));
+  perception(factory.create(p.type, &p, rng()));
 } /* shared_init() */
 
 NS_END(cognitive, d2, controller, fordyca);
@@ -50,6 +50,10 @@ birtd_odpo_controller::~birtd_odpo_controller(void) = default;
 /*******************************************************************************
  * Member Functions
  ******************************************************************************/
+void birtd_odpo_controller::perception_update(void) {
+  perception()->update(m_receptor.get());
+} /* perception_update() */
+
 void birtd_odpo_controller::control_step(void) {
   mdc_ts_update();
   ndc_uuid_push();
@@ -57,7 +61,9 @@ void birtd_odpo_controller::control_step(void) {
             "Carried block%d has robot id=%d",
             block()->id().v(),
             block()->md()->robot_id().v());
-  perception()->update(m_receptor.get());
+  if (!perception_external()) {
+    perception_update();
+  }
 
   /*
    * Reset steering forces tracking so per-timestep visualizations are
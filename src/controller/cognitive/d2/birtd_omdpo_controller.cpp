@@ -50,6 +50,10 @@ birtd_omdpo_controller::~birtd_omdpo_controller(void) = default;
 /*******************************************************************************
  * Member Functions
  ******************************************************************************/
+void birtd_omdpo_controller::perception_update(void) {
+  perception()->update(m_receptor.get());
+} /* perception_update() */
+
 void birtd_omdpo_controller::control_step(void) {
   mdc_ts_update();
   ndc_uuid_push();
@@ -58,7 +62,9 @@ void birtd_omdpo_controller::control_step(void) {
             "Carried block%d has robot id=%d",
             block()->id().v(),
             block()->md()->robot_id().v());
-  perception()->update(m_receptor.get());
+  if (!perception_external()) {
+    perception_update();
+  }
 
   /*
    * Reset steering forces tracking so per-timestep visualizations are
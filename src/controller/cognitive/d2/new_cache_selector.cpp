@@ -23,10 +23,12 @@
  ******************************************************************************/
 #include "fordyca/controller/cognitive/d2/new_cache_selector.hpp"
 
+#include <limits>
+#include <vector>
+
 #include "cosm/arena/repr/base_cache.hpp"
 
 #include "fordyca/controller/cognitive/cache_sel_matrix.hpp"
-#include "fordyca/math/new_cache_utility.hpp"
 #include "fordyca/subsystem/perception/ds/dp_block_map.hpp"
 #include "fordyca/subsystem/perception/ds/dp_cache_map.hpp"
 
@@ -34,7 +36,6 @@
  * Namespaces
  ******************************************************************************/
 NS_START(fordyca, controller, cognitive, d2);
-using cselm = cache_sel_matrix;
 
 /*******************************************************************************
  * Constructors/Destructor
@@ -51,78 +52,87 @@ const crepr::base_block3D*
 new_cache_selector::operator()(const fspds::dp_block_map& new_caches,
                                const fspds::dp_cache_map& existing_caches,
                                const rmath::vector2d& position) const {
-  const crepr::base_block3D* best = nullptr;
   ER_ASSERT(!new_caches.empty(), "No known new caches");
 
-  double max_utility = 0.0;
+  /*
+   * Use the center rather than the anchor to get distances unaffected by the
+   * relative position of an existing cache/block and new cache.
+   */
+  cache_index_type caches(mc_matrix->fields().cache_prox_dist);
+  for (const auto& ec : existing_caches.values_range()) {
+    caches.insert(ec.ent()->rcenter2D(), ec.ent());
+  } /* for(&ec..) */
+
+  block_index_type blocks(mc_matrix->fields().cluster_prox_dist);
+  for (const auto& b : new_caches.values_range()) {
+    blocks.insert(b.ent()->rcenter2D(), b.ent());
+  } /* for(&b..) */
+
+  m_candidates.clear();
+  m_candidates.reserve(new_caches.size());
+  m_batch.reset(new_caches.size());
+
   for (const auto& c : new_caches.values_range()) {
-    if (new_cache_is_excluded(existing_caches, new_caches, c.ent())) {
-      continue;
-    }
     /*
      * Use the center rather than the anchor to get a utility unaffected by the
-     * relative position of the block and the robot
+     * relative position of the block and the robot. A new cache is the same as
+     * a single block.
      */
-    math::new_cache_utility u(
-        c.ent()->rcenter2D(),
-        std::get<rmath::vector2d>(mc_matrix->find(cselm::kNestLoc)->second));
-
-    double utility = u.calc(position, c.density());
-    ER_ASSERT(utility > 0.0, "Bad utility calculation");
-    ER_DEBUG("Utility for new cache%d@%s/%s, density=%f: %f",
-             c.ent()->id().v(),
-             rcppsw::to_string(c.ent()->ranchor2D()).c_str(),
-             rcppsw::to_string(c.ent()->danchor2D()).c_str(),
-             c.density().v(),
-             utility);
-
-    if (utility > max_utility) {
-      best = c.ent();
-      max_utility = utility;
-    }
+    m_batch.add(c.ent()->rcenter2D(),
+                c.density(),
+                1.0,
+                !new_cache_is_excluded(caches, blocks, c.ent()));
+    m_candidates.push_back(c.ent());
   } /* for(new_cache..) */
 
-  ER_CONDI(nullptr != best,
-           "Best utility: new cache%d@%s/%s: %f",
-           best->id().v(),
-           rcppsw::to_string(best->ranchor2D()).c_str(),
-           rcppsw::to_string(best->danchor2D()).c_str(),
-           max_utility);
+  m_batch.cache_utilities_calc(position, mc_matrix->fields().nest_loc);
 
+  const crepr::base_block3D* best = nullptr;
+  if (auto idx = m_batch.best()) {
+    best = m_candidates[*idx];
+    ER_INFO("Best utility: new cache%d@%s/%s: %f",
+            best->id().v(),
+            rcppsw::to_string(best->ranchor2D()).c_str(),
+            rcppsw::to_string(best->danchor2D()).c_str(),
+            m_batch.utility(*idx));
+  }
+  ER_ASSERT(nullptr != best || 0 == m_batch.n_eligible(),
+            "Bad utility calculation");
   ER_CONDW(nullptr == best,
            "No best new cache found: all known new caches excluded!");
   return best;
 } /* operator() */
 
 bool new_cache_selector::new_cache_is_excluded(
-    const fspds::dp_cache_map& existing_caches,
-    const fspds::dp_block_map& blocks,
+    const cache_index_type& caches,
+    const block_index_type& blocks,
     const crepr::base_block3D* const new_cache) const {
-  auto cache_prox = std::get<rtypes::spatial_dist>(
-      mc_matrix->find(cselm::kCacheProxDist)->second);
-  auto cluster_prox = std::get<rtypes::spatial_dist>(
-      mc_matrix->find(cselm::kClusterProxDist)->second);
-
-  /*
-   * Use the center rather than the anchor to get a distance unaffected by the
-   * relative position of an existing cache and new cache.
-   */
-  for (const auto& ec : existing_caches.values_range()) {
-    double dist = (ec.ent()->rcenter2D() - new_cache->rcenter2D()).length();
-    if (cache_prox >= dist) {
-      ER_DEBUG("Ignoring new cache%d@%s/%s: Too close to cache%d@%s/%s (%f <= "
-               "%f)",
-               new_cache->id().v(),
-               rcppsw::to_string(new_cache->ranchor2D()).c_str(),
-               rcppsw::to_string(new_cache->danchor2D()).c_str(),
-               ec.ent()->id().v(),
-               rcppsw::to_string(ec.ent()->rcenter2D()).c_str(),
-               rcppsw::to_string(ec.ent()->dcenter2D()).c_str(),
-               dist,
-               cache_prox.v());
-      return true;
+  auto cache_prox = mc_matrix->fields().cache_prox_dist;
+  auto cluster_prox = mc_matrix->fields().cluster_prox_dist;
+
+  /* find the nearest known cache, if any are within range */
+  const carepr::base_cache* near_cache = nullptr;
+  double cache_dist = std::numeric_limits<double>::max();
+  caches.query(new_cache->rcenter2D(), cache_prox, [&](const auto* ec) {
+    double dist = (ec->rcenter2D() - new_cache->rcenter2D()).length();
+    if (dist < cache_dist) {
+      near_cache = ec;
+      cache_dist = dist;
     }
-  } /* for(&ec..) */
+  });
+  if (nullptr != near_cache && cache_prox >= cache_dist) {
+    ER_DEBUG("Ignoring new cache%d@%s/%s: Too close to cache%d@%s/%s (%f <= "
+             "%f)",
+             new_cache->id().v(),
+             rcppsw::to_string(new_cache->ranchor2D()).c_str(),
+             rcppsw::to_string(new_cache->danchor2D()).c_str(),
+             near_cache->id().v(),
+             rcppsw::to_string(near_cache->rcenter2D()).c_str(),
+             rcppsw::to_string(near_cache->dcenter2D()).c_str(),
+             cache_dist,
+             cache_prox.v());
+    return true;
+  }
 
   /*
    * Because robots have imperfect knowledge of the environment, AND that
@@ -134,25 +144,30 @@ bool new_cache_selector::new_cache_is_excluded(
    * So, we approximate a block distribution as a single block, and only choose
    * new caches that are sufficiently far from any potential clusters.
    */
-  for (const auto& b : blocks.values_range()) {
-    if (b.ent() == new_cache) {
-      continue;
+  const crepr::base_block3D* near_block = nullptr;
+  double block_dist = std::numeric_limits<double>::max();
+  blocks.query(new_cache->rcenter2D(), cluster_prox, [&](const auto* b) {
+    if (b == new_cache) {
+      return;
     }
-    double dist = (b.ent()->rcenter2D() - new_cache->rcenter2D()).length();
-
-    if (cluster_prox >= dist) {
-      ER_DEBUG("Ignoring new cache%d@%s/%s: Too close to potential block "
-               "cluster@%s/%s (%f <= %f)",
-               new_cache->id().v(),
-               rcppsw::to_string(new_cache->ranchor2D()).c_str(),
-               rcppsw::to_string(new_cache->danchor2D()).c_str(),
-               rcppsw::to_string(b.ent()->ranchor2D()).c_str(),
-               rcppsw::to_string(b.ent()->danchor2D()).c_str(),
-               dist,
-               cluster_prox.v());
-      return true;
+    double dist = (b->rcenter2D() - new_cache->rcenter2D()).length();
+    if (dist < block_dist) {
+      near_block = b;
+      block_dist = dist;
     }
-  } /* for(&b..) */
+  });
+  if (nullptr != near_block && cluster_prox >= block_dist) {
+    ER_DEBUG("Ignoring new cache%d@%s/%s: Too close to potential block "
+             "cluster@%s/%s (%f <= %f)",
+             new_cache->id().v(),
+             rcppsw::to_string(new_cache->ranchor2D()).c_str(),
+             rcppsw::to_string(new_cache->danchor2D()).c_str(),
+             rcppsw::to_string(near_block->ranchor2D()).c_str(),
+             rcppsw::to_string(near_block->danchor2D()).c_str(),
+             block_dist,
+             cluster_prox.v());
+    return true;
+  }
 
   return false;
 } /* new_cache_is_excluded() */
@@ -44,7 +44,7 @@ void cell2D_empty::visit(fspds::occupancy_grid& grid) {
             grid.known_cell_count(),
             grid.xdsize(),
             grid.ydsize());
-  grid.access<fspds::occupancy_grid::kPheromone>(x(), y()).reset();
+  grid.pheromone(x(), y()).reset();
   visit(cell);
 } /* visit() */
 
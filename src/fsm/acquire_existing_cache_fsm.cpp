@@ -29,8 +29,6 @@
 
 #include "fordyca/fsm/arrival_tol.hpp"
 #include "fordyca/fsm/cache_acq_point_selector.hpp"
-#include "fordyca/fsm/cache_acq_validator.hpp"
-#include "fordyca/fsm/existing_cache_selector.hpp"
 #include "fordyca/fsm/foraging_acq_goal.hpp"
 #include "fordyca/fsm/foraging_transport_goal.hpp"
 #include "fordyca/subsystem/perception/ds/dpo_store.hpp"
@@ -92,7 +90,9 @@ acquire_existing_cache_fsm::acquire_existing_cache_fsm(
                             std::placeholders::_2)) }),
       mc_for_pickup(for_pickup),
       mc_matrix(c_ro->csel_matrix),
-      mc_store(c_ro->store) {}
+      mc_store(c_ro->store),
+      m_selector(mc_for_pickup, mc_matrix, &mc_store->tracked_caches()),
+      m_validator(&mc_store->tracked_caches(), mc_matrix, mc_for_pickup) {}
 
 /*******************************************************************************
  * Non-Member Functions
@@ -107,12 +107,9 @@ acquire_existing_cache_fsm::acq_goal_internal(void) {
  ******************************************************************************/
 boost::optional<acquire_existing_cache_fsm::acq_loc_type>
 acquire_existing_cache_fsm::calc_acq_location(void) {
-  existing_cache_selector selector(
-      mc_for_pickup, mc_matrix, &mc_store->tracked_caches());
-
-  if (const auto* best = selector(mc_store->tracked_caches(),
-                                  saa()->sensing()->rpos2D(),
-                                  saa()->sensing()->tick())) {
+  if (const auto* best = m_selector(mc_store->tracked_caches(),
+                                    saa()->sensing()->rpos2D(),
+                                    saa()->sensing()->tick())) {
     ER_INFO("Selected existing cache%d@%s/%s for acquisition",
             best->id().v(),
             rcppsw::to_string(best->rcenter2D()).c_str(),
@@ -141,7 +138,7 @@ acquire_existing_cache_fsm::existing_cache_select(void) {
 } /* existing_cache_select() */
 
 bool acquire_existing_cache_fsm::candidates_exist(void) const {
-  return !mc_store->known_caches().empty();
+  return 0 != mc_store->n_known_caches();
 } /* candidates() */
 
 bool acquire_existing_cache_fsm::cache_acquired_cb(bool explore_result) {
@@ -159,9 +156,7 @@ bool acquire_existing_cache_fsm::cache_acquired_cb(bool explore_result) {
 
 bool acquire_existing_cache_fsm::cache_acq_valid(const rmath::vector2d& loc,
                                                  const rtypes::type_uuid& id) {
-  auto caches = mc_store->known_caches();
-  return cache_acq_validator(caches, mc_matrix, mc_for_pickup)(
-      loc, id, saa()->sensing()->tick());
+  return m_validator(loc, id, saa()->sensing()->tick());
 } /* cache_acq_valid() */
 
 NS_END(controller, fordyca);
@@ -28,9 +28,7 @@
 #include "cosm/subsystem/saa_subsystemQ3D.hpp"
 #include "cosm/subsystem/sensing_subsystemQ3D.hpp"
 
-#include "fordyca/controller/cognitive/block_selector.hpp"
 #include "fordyca/fsm/arrival_tol.hpp"
-#include "fordyca/fsm/block_acq_validator.hpp"
 #include "fordyca/fsm/foraging_signal.hpp"
 #include "fordyca/subsystem/perception/ds/dpo_store.hpp"
 
@@ -79,7 +77,9 @@ acquire_free_block_fsm::acquire_free_block_fsm(
                             std::placeholders::_1,
                             std::placeholders::_2)) }),
       mc_matrix(c_ro->bsel_matrix),
-      mc_store(c_ro->store) {}
+      mc_store(c_ro->store),
+      m_selector(mc_matrix),
+      m_validator(&mc_store->tracked_blocks(), mc_matrix) {}
 
 /*******************************************************************************
  * Member Functions
@@ -104,10 +104,8 @@ bool acquire_free_block_fsm::block_acquired_cb(bool explore_result) {
 
 boost::optional<csfsm::acquire_goal_fsm::candidate_type>
 acquire_free_block_fsm::block_select(void) const {
-  controller::cognitive::block_selector selector(mc_matrix);
-
   if (const auto* best =
-          selector(mc_store->tracked_blocks(), saa()->sensing()->rpos2D())) {
+          m_selector(mc_store->tracked_blocks(), saa()->sensing()->rpos2D())) {
     return boost::make_optional(acquire_goal_fsm::candidate_type(
         best->rcenter2D(), kBLOCK_ARRIVAL_TOL, best->id()));
   } else {
@@ -116,12 +114,12 @@ acquire_free_block_fsm::block_select(void) const {
 } /* block_select() */
 
 bool acquire_free_block_fsm::candidates_exist(void) const {
-  return !mc_store->known_blocks().empty();
+  return 0 != mc_store->n_known_blocks();
 } /* candidates_exist() */
 
 bool acquire_free_block_fsm::block_acq_valid(const rmath::vector2d& loc,
                                              const rtypes::type_uuid& id) const {
-  return block_acq_validator(&mc_store->tracked_blocks(), mc_matrix)(loc, id);
+  return m_validator(loc, id);
 } /* block_acq_valid() */
 
 /*******************************************************************************
@@ -34,7 +34,7 @@
  * Namespaces/Decls
  ******************************************************************************/
 NS_START(fordyca, fsm);
-using bselm = controller::cognitive::block_sel_matrix;
+using bself = controller::cognitive::block_sel_fields;
 
 /*******************************************************************************
  * Constructors/Destructors
@@ -60,14 +60,13 @@ bool block_acq_validator::operator()(const rmath::vector2d& loc,
             loc.to_str().c_str());
     return false;
   }
-  const auto& config = std::get<fcconfig::block_sel::block_pickup_policy_config>(
-      mc_matrix->find(bselm::kPickupPolicy)->second);
+  const auto& fields = mc_matrix->fields();
 
   /*
    * Unless we have the cluster proximity policy, we are good to go on
    * validation if we make it this far.
    */
-  if (bselm::kPickupPolicyClusterProx == config.policy) {
+  if (bself::ekPICKUP_POLICY_CLUSTER_PROX == fields.pickup_type) {
     auto range = mc_map->values_range();
     if (!range.empty()) {
       auto avg_position =
@@ -79,7 +78,7 @@ bool block_acq_validator::operator()(const rmath::vector2d& loc,
                           }) /
           boost::size(range);
 
-      return (loc - avg_position).length() < config.prox_dist;
+      return (loc - avg_position).length() < fields.pickup_policy.prox_dist;
     }
   }
   return true;
@@ -33,7 +33,7 @@
  * Namespaces/Decls
  ******************************************************************************/
 NS_START(fordyca, fsm);
-using cselm = controller::cognitive::cache_sel_matrix;
+using cself = controller::cognitive::cache_sel_fields;
 
 /*******************************************************************************
  * Constructors/Destructors
@@ -45,8 +45,8 @@ cache_acq_validator::cache_acq_validator(
     : ER_CLIENT_INIT("fordyca.fsm.cache_acq_validator"),
       mc_for_pickup(for_pickup),
       mc_csel_matrix(csel_matrix),
-      mc_caches(fspds::dp_cache_map::raw_values_extract<cads::bcache_vectorno>(
-          *dpo_map)) {}
+      mc_cache_map(dpo_map),
+      mc_caches() {}
 
 cache_acq_validator::cache_acq_validator(
     const cads::bcache_vectorno& caches,
@@ -55,6 +55,7 @@ cache_acq_validator::cache_acq_validator(
     : ER_CLIENT_INIT("fordyca.fsm.cache_acq_validator"),
       mc_for_pickup(for_pickup),
       mc_csel_matrix(csel_matrix),
+      mc_cache_map(nullptr),
       mc_caches(caches) {}
 
 /*******************************************************************************
@@ -69,19 +70,17 @@ bool cache_acq_validator::operator()(const rmath::vector2d& loc,
    * the cache's host cell location. Instead we look up the cache by ID, and
    * verify that the cache exists contains the point we are acquiring.
    */
-  auto it = std::find_if(mc_caches.begin(), mc_caches.end(), [&](const auto& c) {
-    return c->id() == id;
-  });
+  const auto* cache = cache_find(id);
 
-  if (mc_caches.end() == it) {
+  if (nullptr == cache) {
     ER_WARN("Cache%d near %s invalid for acquisition: cache unknown",
             id.v(),
             loc.to_str().c_str());
     return false;
-  } else if (!(*it)->contains_point(loc)) {
+  } else if (!cache->contains_point(loc)) {
     ER_WARN("Cache%d@%s invalid for acquisition: does not contain %s",
             id.v(),
-            rcppsw::to_string((*it)->dcenter2D()).c_str(),
+            rcppsw::to_string(cache->dcenter2D()).c_str(),
             rcppsw::to_string(loc).c_str());
     return false;
   }
@@ -96,22 +95,35 @@ bool cache_acq_validator::operator()(const rmath::vector2d& loc,
   }
 
   /* verify pickup policy */
-  return pickup_policy_validate(*it, t);
+  return pickup_policy_validate(cache, t);
 } /* operator()() */
 
+const carepr::base_cache*
+cache_acq_validator::cache_find(const rtypes::type_uuid& id) const {
+  if (nullptr != mc_cache_map) {
+    const auto* cache = mc_cache_map->alt_find(id);
+    return (nullptr == cache) ? nullptr : cache->ent();
+  }
+  auto it = std::find_if(mc_caches.begin(), mc_caches.end(), [&](const auto& c) {
+    return c->id() == id;
+  });
+  return (mc_caches.end() == it) ? nullptr : *it;
+} /* cache_find() */
+
 bool cache_acq_validator::pickup_policy_validate(const carepr::base_cache* cache,
                                                  const rtypes::timestep& t) const {
-  const auto& config = std::get<fcconfig::cache_sel::cache_pickup_policy_config>(
-      mc_csel_matrix->find(cselm::kPickupPolicy)->second);
+  const auto& fields = mc_csel_matrix->fields();
+  const auto& config = fields.pickup_policy;
 
-  if (cselm::kPickupPolicyTime == config.policy && t < config.timestep) {
+  if (cself::ekPICKUP_POLICY_TIME == fields.pickup_type &&
+      t < config.timestep) {
     ER_DEBUG("Cache%d invalid for acquisition: policy=%s, %zu < %zu",
              cache->id().v(),
              config.policy.c_str(),
              t.v(),
              config.timestep.v());
     return false;
-  } else if (cselm::kPickupPolicyCacheSize == config.policy &&
+  } else if (cself::ekPICKUP_POLICY_CACHE_SIZE == fields.pickup_type &&
              cache->n_blocks() < config.cache_size) {
     ER_DEBUG("Cache%d invalid for acquisition: policy=%s, %zu < %zu",
              cache->id().v(),
@@ -119,7 +131,7 @@ bool cache_acq_validator::pickup_policy_validate(const carepr::base_cache* cache
              cache->n_blocks(),
              config.cache_size);
     return false;
-  } else if (cselm::kPickupPolicyCacheDuration == config.policy &&
+  } else if (cself::ekPICKUP_POLICY_CACHE_DURATION == fields.pickup_type &&
              t - cache->creation_ts() < config.timestep) {
     ER_DEBUG("Cache%d invalid for acquisition: policy=%s, %zu < %zu",
              cache->id().v(),
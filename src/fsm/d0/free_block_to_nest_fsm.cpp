@@ -34,7 +34,6 @@
 NS_START(fordyca, fsm, d0);
 
 using goal_type = csmetrics::goal_acq_metrics::goal_type;
-using bsel_matrix = controller::cognitive::block_sel_matrix;
 
 /*******************************************************************************
  * Constructors/Destructors
@@ -70,8 +69,7 @@ free_block_to_nest_fsm::free_block_to_nest_fsm(
                                              &entry_transport_to_nest,
                                              &exit_transport_to_nest),
           RCPPSW_HFSM_STATE_MAP_ENTRY_EX(&finished)),
-      mc_nest_loc(std::get<rmath::vector2d>(
-          c_ro->bsel_matrix->find(bsel_matrix::kNestLoc)->second)),
+      mc_nest_loc(c_ro->bsel_matrix->fields().nest_loc),
       m_block_fsm(c_ro,
                   c_no,
                   std::move(foraging_util_hfsm::strategies().explore),
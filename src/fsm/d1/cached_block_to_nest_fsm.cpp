@@ -35,8 +35,6 @@
  ******************************************************************************/
 NS_START(fordyca, fsm, d1);
 
-using csel_matrix = controller::cognitive::cache_sel_matrix;
-
 /*******************************************************************************
  * Constructors/Destructors
  ******************************************************************************/
@@ -78,8 +76,7 @@ cached_block_to_nest_fsm::cached_block_to_nest_fsm(
                                              &entry_leaving_nest,
                                              &exit_leaving_nest),
           RCPPSW_HFSM_STATE_MAP_ENTRY_EX(&finished)),
-      mc_nest_loc(std::get<rmath::vector2d>(
-          c_ro->csel_matrix->find(csel_matrix::kNestLoc)->second)),
+      mc_nest_loc(c_ro->csel_matrix->fields().nest_loc),
       m_cache_fsm(c_ro,
                   c_no,
                   std::move(foraging_util_hfsm::strategies().explore),
@@ -28,7 +28,6 @@
 #include "cosm/subsystem/sensing_subsystemQ3D.hpp"
 
 #include "fordyca/controller/cognitive/cache_sel_matrix.hpp"
-#include "fordyca/controller/cognitive/d2/new_cache_selector.hpp"
 #include "fordyca/fsm/arrival_tol.hpp"
 #include "fordyca/fsm/foraging_acq_goal.hpp"
 #include "fordyca/subsystem/perception/ds/dpo_semantic_map.hpp"
@@ -38,7 +37,6 @@
  * Namespaces
  ******************************************************************************/
 NS_START(fordyca, fsm, d2);
-using cselm = controller::cognitive::cache_sel_matrix;
 
 /*******************************************************************************
  * Constructors/Destructors
@@ -81,30 +79,28 @@ acquire_new_cache_fsm::acquire_new_cache_fsm(
                     return true;
                   }) }),
       mc_matrix(c_ro->csel_matrix),
-      mc_store(c_ro->store) {}
+      mc_store(c_ro->store),
+      m_selector(mc_matrix) {}
 
 /*******************************************************************************
  * General Member Functions
  ******************************************************************************/
 bool acquire_new_cache_fsm::candidates_exist(void) const {
-  return !mc_store->known_blocks().empty();
+  return 0 != mc_store->n_known_blocks();
 } /* candidates_exsti() */
 
 boost::optional<csfsm::acquire_goal_fsm::candidate_type>
 acquire_new_cache_fsm::cache_select(void) {
-  controller::cognitive::d2::new_cache_selector selector(mc_matrix);
-
   /* A "new" cache is the same as a single block  */
-  if (const auto* best = selector(mc_store->tracked_blocks(),
-                                  mc_store->tracked_caches(),
-                                  sensing()->rpos2D())) {
+  if (const auto* best = m_selector(mc_store->tracked_blocks(),
+                                    mc_store->tracked_caches(),
+                                    sensing()->rpos2D())) {
     ER_INFO("Select new cache%d@%s/%s for acquisition",
             best->id().v(),
             rcppsw::to_string(best->ranchor2D()).c_str(),
             rcppsw::to_string(best->danchor2D()).c_str());
 
-    auto tol = std::get<rtypes::spatial_dist>(
-        mc_matrix->find(cselm::kNewCacheDropTolerance)->second);
+    auto tol = mc_matrix->fields().new_cache_tol;
     return boost::make_optional(
         acquire_goal_fsm::candidate_type(best->rcenter2D(), tol.v(), best->id()));
   } else {
@@ -119,7 +115,7 @@ acquire_new_cache_fsm::cache_select(void) {
 bool acquire_new_cache_fsm::cache_acquired_cb(bool explore_result) const {
   ER_ASSERT(!explore_result, "New cache acquisition via exploration?");
   rmath::vector2d position = saa()->sensing()->rpos2D();
-  for (const auto& b : mc_store->known_blocks()) {
+  for (const auto* b : mc_store->known_blocks_range()) {
     if ((b->rcenter2D() - position).length() <= kNEW_CACHE_ARRIVAL_TOL) {
       return true;
     }
@@ -23,6 +23,9 @@
  ******************************************************************************/
 #include "fordyca/fsm/d2/cache_site_selector.hpp"
 
+#include <algorithm>
+#include <limits>
+
 #include "cosm/arena/repr/base_cache.hpp"
 
 #include "fordyca/controller/cognitive/cache_sel_matrix.hpp"
@@ -34,7 +37,6 @@
  * Namespaces
  ******************************************************************************/
 NS_START(fordyca, fsm, d2);
-using cselm = controller::cognitive::cache_sel_matrix;
 
 /*******************************************************************************
  * Constructors/Destructor
@@ -79,9 +81,8 @@ cache_site_selector::operator()(const cads::bcache_vectorno& known_caches,
 
   ER_INFO("Computed cache site@%s", rcppsw::to_string(site).c_str());
 
-  bool site_ok = verify_site(site, known_caches);
-  bool strict =
-      std::get<bool>(mc_matrix->find(cselm::kStrictConstraints)->second);
+  bool site_ok = verify_site(site);
+  bool strict = mc_matrix->fields().strict_constraints;
 
   if (site_ok || (!site_ok && !strict)) {
     return boost::make_optional(site);
@@ -92,21 +93,27 @@ cache_site_selector::operator()(const cads::bcache_vectorno& known_caches,
   }
 } /* operator()() */
 
-bool cache_site_selector::verify_site(
-    const rmath::vector2d& site,
-    const cads::bcache_vectorno& known_caches) const {
+bool cache_site_selector::verify_site(const rmath::vector2d& site) const {
   const nest_constraint_data* ndata = &std::get<1>(m_constraints)[0];
+  auto cache_prox = mc_matrix->fields().cache_prox_dist;
 
-  /* check distances to known caches */
-  for (const auto& c : known_caches) {
-    ER_CHECK(rtypes::spatial_dist((c->rcenter2D() - site).length()) >=
-                 std::get<0>(m_constraints)[0].cache_prox,
-             "Cache site@%s too close to cache%d (%f <= %f)",
-             rcppsw::to_string(site).c_str(),
-             c->id().v(),
-             (c->rcenter2D() - site).length(),
-             std::get<0>(m_constraints)[0].cache_prox.v());
-  } /* for(&c..) */
+  /* check distance to nearest known cache */
+  const carepr::base_cache* nearest = nullptr;
+  double nearest_dist = std::numeric_limits<double>::max();
+  m_cache_index->query(site, cache_prox, [&](const carepr::base_cache* c) {
+    double dist = (c->rcenter2D() - site).length();
+    if (dist < nearest_dist) {
+      nearest_dist = dist;
+      nearest = c;
+    }
+  });
+  ER_CHECK(nullptr == nearest ||
+               rtypes::spatial_dist(nearest_dist) >= cache_prox,
+           "Cache site@%s too close to cache%d (%f <= %f)",
+           rcppsw::to_string(site).c_str(),
+           nearest->id().v(),
+           nearest_dist,
+           cache_prox.v());
 
   /* check distance to nest center */
   ER_CHECK(rtypes::spatial_dist((ndata->nest_loc - site).length()) >=
@@ -126,8 +133,7 @@ void cache_site_selector::opt_initialize(const opt_init_conditions* cond,
                                          struct site_utility_data* utility_data,
                                          std::vector<double>* initial_guess,
                                          rmath::rng* rng) {
-  rmath::vector2d nest_loc =
-      std::get<rmath::vector2d>(mc_matrix->find(cselm::kNestLoc)->second);
+  rmath::vector2d nest_loc = mc_matrix->fields().nest_loc;
 
   ER_INFO("Known caches: [%s]", rcppsw::to_string(cond->known_caches).c_str());
 
@@ -136,14 +142,13 @@ void cache_site_selector::opt_initialize(const opt_init_conditions* cond,
    * that is OK because we always have at least the nest proximity constraint.
    */
   constraints_create(cond->known_caches, nest_loc);
-  ER_INFO("Calculated %zu cache, %zu nest constraints",
+  ER_INFO("Calculated %zu cache, %zu nest constraints (%zu indexed caches)",
           std::get<0>(m_constraints).size(),
-          std::get<1>(m_constraints).size());
+          std::get<1>(m_constraints).size(),
+          m_cache_index->size());
 
-  auto xrange =
-      std::get<rmath::rangez>(mc_matrix->find(cselm::kSiteXRange)->second);
-  auto yrange =
-      std::get<rmath::rangez>(mc_matrix->find(cselm::kSiteYRange)->second);
+  auto xrange = mc_matrix->fields().site_xrange;
+  auto yrange = mc_matrix->fields().site_yrange;
   *utility_data = { cond->position, nest_loc };
   m_alg.set_max_objective(&__site_utility_func, utility_data);
   m_alg.set_ftol_rel(kUTILITY_TOL);
@@ -172,25 +177,26 @@ void cache_site_selector::opt_initialize(const opt_init_conditions* cond,
 void cache_site_selector::constraints_create(
     const cads::bcache_vectorno& known_caches,
     const rmath::vector2d& nest_loc) {
-  for (const auto& c : known_caches) {
-    std::get<0>(m_constraints)
-        .push_back({ c,
-                     this,
-                     std::get<rtypes::spatial_dist>(
-                         mc_matrix->find(cselm::kCacheProxDist)->second) });
-  } /* for(&c..) */
+  auto cache_prox = mc_matrix->fields().cache_prox_dist;
 
-  std::get<1>(m_constraints)
-      .push_back({ nest_loc,
-                   this,
-                   std::get<rtypes::spatial_dist>(
-                       mc_matrix->find(cselm::kNestProxDist)->second) });
+  /*
+   * Bucket the known caches by their location, using the cache proximity
+   * distance as the bucket size, so that each constraint evaluation only has
+   * to look at the caches in the buckets around the point being evaluated.
+   */
+  m_cache_index = std::make_unique<cache_index_type>(cache_prox);
+  for (const auto* c : known_caches) {
+    m_cache_index->insert(c->rcenter2D(), c);
+  } /* for(*c..) */
 
-  for (auto& c : std::get<0>(m_constraints)) {
-    m_alg.add_inequality_constraint(
-        __cache_constraint_func, &c, kCACHE_CONSTRAINT_TOL);
-  } /* for(c..) */
+  std::get<0>(m_constraints)
+      .push_back({ m_cache_index.get(), this, cache_prox });
+  std::get<1>(m_constraints)
+      .push_back({ nest_loc, this, mc_matrix->fields().nest_prox_dist });
 
+  m_alg.add_inequality_constraint(__cache_constraint_func,
+                                  &std::get<0>(m_constraints)[0],
+                                  kCACHE_CONSTRAINT_TOL);
   m_alg.add_inequality_constraint(__nest_constraint_func,
                                   &std::get<1>(m_constraints)[0],
                                   kNEST_CONSTRAINT_TOL);
@@ -236,11 +242,28 @@ double __cache_constraint_func(const std::vector<double>& x,
     return std::numeric_limits<double>::max();
   }
   auto* c = reinterpret_cast<cache_site_selector::cache_constraint_data*>(data);
-  double val = c->cache_prox.v() -
-               (rmath::vector2d(x[0], x[1]) - c->mc_cache->rcenter2D()).length();
-  return val;
+  return cache_prox_violation(*c->caches,
+                              rmath::vector2d(x[0], x[1]),
+                              c->cache_prox);
 } /* __cache_constraint_func() */
 
+double cache_prox_violation(const cache_site_selector::cache_index_type& caches,
+                            const rmath::vector2d& point,
+                            const rtypes::spatial_dist& cache_prox) {
+  /*
+   * Sum the violations for every cache that is too close, rather than only
+   * considering the nearest one, so that infeasible points are penalized
+   * against all of the caches they are too close to, as they were when there
+   * was one constraint per known cache.
+   */
+  double violation = 0.0;
+  caches.query(point, cache_prox, [&](const carepr::base_cache* c) {
+    violation += std::max(0.0,
+                          cache_prox.v() - (c->rcenter2D() - point).length());
+  });
+  return violation;
+} /* cache_prox_violation() */
+
 double __nest_constraint_func(const std::vector<double>& x,
                               std::vector<double>&,
                               void* data) {
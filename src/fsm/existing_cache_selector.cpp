@@ -23,18 +23,17 @@
  ******************************************************************************/
 #include "fordyca/fsm/existing_cache_selector.hpp"
 
+#include <vector>
+
 #include "cosm/arena/repr/base_cache.hpp"
 
 #include "fordyca/controller/cognitive/cache_sel_matrix.hpp"
-#include "fordyca/fsm/cache_acq_validator.hpp"
-#include "fordyca/math/existing_cache_utility.hpp"
 #include "fordyca/subsystem/perception/ds/dp_cache_map.hpp"
 
 /*******************************************************************************
  * Namespaces
  ******************************************************************************/
 NS_START(fordyca, fsm);
-using cselm = controller::cognitive::cache_sel_matrix;
 
 /*******************************************************************************
  * Constructors/Destructor
@@ -46,7 +45,8 @@ existing_cache_selector::existing_cache_selector(
     : ER_CLIENT_INIT("fordyca.fsm.existing_cache_selector"),
       mc_is_pickup(is_pickup),
       mc_matrix(matrix),
-      mc_cache_map(cache_map) {}
+      mc_cache_map(cache_map),
+      m_validator(mc_cache_map, mc_matrix, mc_is_pickup) {}
 
 /*******************************************************************************
  * Member Functions
@@ -54,44 +54,37 @@ existing_cache_selector::existing_cache_selector(
 const carepr::base_cache*
 existing_cache_selector::operator()(const fspds::dp_cache_map& existing_caches,
                                     const rmath::vector2d& position,
-                                    const rtypes::timestep& t) {
-  const carepr::base_cache* best = nullptr;
+                                    const rtypes::timestep& t) const {
   ER_ASSERT(!existing_caches.empty(), "No known existing caches");
 
-  double max_utility = 0.0;
+  m_candidates.clear();
+  m_candidates.reserve(existing_caches.size());
+  m_batch.reset(existing_caches.size());
+
   for (const auto& c : existing_caches.values_range()) {
-    fsm::cache_acq_validator validator(mc_cache_map, mc_matrix, mc_is_pickup);
-
-    if (!validator(c.ent()->rcenter2D(), c.ent()->id(), t) ||
-        cache_is_excluded(position, c.ent())) {
-      continue;
-    }
-    math::existing_cache_utility u(
-        c.ent()->rcenter2D(),
-        std::get<rmath::vector2d>(mc_matrix->find(cselm::kNestLoc)->second));
-
-    double utility = u.calc(position, c.density(), c.ent()->n_blocks());
-    ER_ASSERT(utility > 0.0, "Bad utility calculation");
-    ER_DEBUG("Utility for existing_cache%d@%s/%s, density=%f: %f",
-             c.ent()->id().v(),
-             rcppsw::to_string(c.ent()->rcenter2D()).c_str(),
-             rcppsw::to_string(c.ent()->dcenter2D()).c_str(),
-             c.density().v(),
-             utility);
-
-    if (utility > max_utility) {
-      best = c.ent();
-      max_utility = utility;
-    }
+    bool eligible = m_validator(c.ent()->rcenter2D(), c.ent()->id(), t) &&
+                    !cache_is_excluded(position, c.ent());
+    m_batch.add(c.ent()->rcenter2D(),
+                c.density(),
+                static_cast<double>(c.ent()->n_blocks()),
+                eligible);
+    m_candidates.push_back(c.ent());
   } /* for(existing_cache..) */
 
-  ER_CONDI(nullptr != best,
-           "Best utility: existing_cache%d@%s/%s w/%zu blocks: %f",
-           best->id().v(),
-           rcppsw::to_string(best->rcenter2D()).c_str(),
-           rcppsw::to_string(best->dcenter2D()).c_str(),
-           best->n_blocks(),
-           max_utility);
+  m_batch.cache_utilities_calc(position, mc_matrix->fields().nest_loc);
+
+  const carepr::base_cache* best = nullptr;
+  if (auto idx = m_batch.best()) {
+    best = m_candidates[*idx];
+    ER_INFO("Best utility: existing_cache%d@%s/%s w/%zu blocks: %f",
+            best->id().v(),
+            rcppsw::to_string(best->rcenter2D()).c_str(),
+            rcppsw::to_string(best->dcenter2D()).c_str(),
+            best->n_blocks(),
+            m_batch.utility(*idx));
+  }
+  ER_ASSERT(nullptr != best || 0 == m_batch.n_eligible(),
+            "Bad utility calculation");
   ER_CONDD(nullptr == best,
            "No best existing cache found: all known caches excluded!");
   return best;
@@ -118,18 +111,11 @@ bool existing_cache_selector::cache_is_excluded(
     return true;
   }
 
-  std::vector<rtypes::type_uuid> exceptions;
-  if (mc_is_pickup) {
-    exceptions = std::get<std::vector<rtypes::type_uuid>>(
-        mc_matrix->find(cselm::kPickupExceptions)->second);
-  } else {
-    exceptions = std::get<std::vector<rtypes::type_uuid>>(
-        mc_matrix->find(cselm::kDropExceptions)->second);
-  }
+  const auto& exceptions = mc_is_pickup
+                               ? mc_matrix->fields().pickup_exceptions
+                               : mc_matrix->fields().drop_exceptions;
 
-  if (std::any_of(exceptions.begin(), exceptions.end(), [&](auto& id) {
-        return id == cache->id();
-      })) {
+  if (exceptions.contains(cache->id())) {
     ER_DEBUG("Ignoring cache%d@%s/%s: On exception list",
              cache->id().v(),
              rcppsw::to_string(cache->rcenter2D()).c_str(),
@@ -0,0 +1,127 @@
+/**
+ * \file utility_batch.cpp
+ *
+ * \copyright 2022 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "fordyca/math/utility_batch.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, math);
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+void utility_batch::reset(size_t n_candidates) {
+  m_x.clear();
+  m_y.clear();
+  m_density.clear();
+  m_weight.clear();
+  m_mask.clear();
+  m_utility.clear();
+
+  m_x.reserve(n_candidates);
+  m_y.reserve(n_candidates);
+  m_density.reserve(n_candidates);
+  m_weight.reserve(n_candidates);
+  m_mask.reserve(n_candidates);
+} /* reset() */
+
+void utility_batch::add(const rmath::vector2d& loc,
+                        const crepr::pheromone_density& density,
+                        double weight,
+                        bool eligible) {
+  m_x.push_back(loc.x());
+  m_y.push_back(loc.y());
+  m_density.push_back(density.v());
+  m_weight.push_back(weight);
+  m_mask.push_back(static_cast<uint8_t>(eligible));
+} /* add() */
+
+void utility_batch::block_utilities_calc(const rmath::vector2d& rloc,
+                                         const rmath::vector2d& nest_loc) {
+  size_t n = size();
+  m_utility.resize(n);
+
+  const double* x = m_x.data();
+  const double* y = m_y.data();
+  const double* density = m_density.data();
+  const double* priority = m_weight.data();
+  const uint8_t* mask = m_mask.data();
+  double* utility = m_utility.data();
+
+  for (size_t i = 0; i < n; ++i) {
+    double nest_dx = x[i] - nest_loc.x();
+    double nest_dy = y[i] - nest_loc.y();
+    double robot_dx = x[i] - rloc.x();
+    double robot_dy = y[i] - rloc.y();
+    double u = (std::sqrt(nest_dx * nest_dx + nest_dy * nest_dy) /
+                std::sqrt(robot_dx * robot_dx + robot_dy * robot_dy)) *
+               std::exp(density[i] * priority[i]);
+    utility[i] = mask[i] ? u : 0.0;
+  } /* for(i..) */
+} /* block_utilities_calc() */
+
+void utility_batch::cache_utilities_calc(const rmath::vector2d& rloc,
+                                         const rmath::vector2d& nest_loc) {
+  size_t n = size();
+  m_utility.resize(n);
+
+  const double* x = m_x.data();
+  const double* y = m_y.data();
+  const double* density = m_density.data();
+  const double* n_blocks = m_weight.data();
+  const uint8_t* mask = m_mask.data();
+  double* utility = m_utility.data();
+
+  for (size_t i = 0; i < n; ++i) {
+    double nest_dx = x[i] - nest_loc.x();
+    double nest_dy = y[i] - nest_loc.y();
+    double robot_dx = x[i] - rloc.x();
+    double robot_dy = y[i] - rloc.y();
+    double u = (std::exp(density[i]) * n_blocks[i]) /
+               (std::sqrt(robot_dx * robot_dx + robot_dy * robot_dy) *
+                std::sqrt(nest_dx * nest_dx + nest_dy * nest_dy));
+    utility[i] = mask[i] ? u : 0.0;
+  } /* for(i..) */
+} /* cache_utilities_calc() */
+
+boost::optional<size_t> utility_batch::best(void) const {
+  boost::optional<size_t> best;
+  double max_utility = 0.0;
+  for (size_t i = 0; i < m_utility.size(); ++i) {
+    if (m_utility[i] > max_utility) {
+      best = i;
+      max_utility = m_utility[i];
+    }
+  } /* for(i..) */
+  return best;
+} /* best() */
+
+size_t utility_batch::n_eligible(void) const {
+  return std::count(m_mask.begin(), m_mask.end(), 1);
+} /* n_eligible() */
+
+NS_END(math, fordyca);
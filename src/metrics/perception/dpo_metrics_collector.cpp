@@ -69,6 +69,11 @@ void dpo_metrics_collector::collect(const rmetrics::base_metrics& metrics) {
   ral::mt_accum(m_data.cum.block_density_sum, m->avg_block_density().v());
   ral::mt_accum(m_data.interval.cache_density_sum, m->avg_cache_density().v());
   ral::mt_accum(m_data.cum.block_density_sum, m->avg_cache_density().v());
+
+  ral::mt_accum(m_data.interval.los_verifications,
+                static_cast<size_t>(m->los_verified()));
+  ral::mt_accum(m_data.cum.los_verifications,
+                static_cast<size_t>(m->los_verified()));
 } /* collect() */
 
 void dpo_metrics_collector::reset_after_interval(void) {
@@ -77,6 +82,7 @@ void dpo_metrics_collector::reset_after_interval(void) {
   m_data.interval.known_caches = 0;
   m_data.interval.block_density_sum = 0.0;
   m_data.interval.cache_density_sum = 0.0;
+  m_data.interval.los_verifications = 0;
 } /* reset_after_interval() */
 
 NS_END(perception, metrics, fordyca);
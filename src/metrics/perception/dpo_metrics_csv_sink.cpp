@@ -53,7 +53,9 @@ dpo_metrics_csv_sink::csv_header_cols(const rmetrics::base_data*) const {
       "int_avg_block_pheromone_density",
       "cum_avg_block_pheromone_density",
       "int_avg_cache_pheromone_density",
-      "cum_avg_cache_pheromone_density"
+      "cum_avg_cache_pheromone_density",
+      "int_avg_los_verifications",
+      "cum_avg_los_verifications"
     /* clang-format on */
   };
   merged.splice(merged.end(), cols);
@@ -80,7 +82,11 @@ dpo_metrics_csv_sink::csv_line_build(const rmetrics::base_data* data,
   line += csv_entry_domavg(d->cum.block_density_sum, d->cum.robot_count);
   line +=
       csv_entry_domavg(d->interval.cache_density_sum, d->interval.robot_count);
-  line += csv_entry_domavg(d->cum.cache_density_sum, d->cum.robot_count, true);
+  line += csv_entry_domavg(d->cum.cache_density_sum, d->cum.robot_count);
+
+  line +=
+      csv_entry_domavg(d->interval.los_verifications, d->interval.robot_count);
+  line += csv_entry_domavg(d->cum.los_verifications, d->cum.robot_count, true);
 
   return boost::make_optional(line);
 } /* csv_line_build() */
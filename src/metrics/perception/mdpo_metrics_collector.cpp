@@ -73,6 +73,10 @@ void mdpo_metrics_collector::collect(const rmetrics::base_metrics& metrics) {
   ral::mt_accum(m_data.interval.unknown_percent, m->unknown_percentage());
   ral::mt_accum(m_data.cum.known_percent, m->known_percentage());
   ral::mt_accum(m_data.cum.unknown_percent, m->unknown_percentage());
+  ral::mt_accum(m_data.interval.los_verifications,
+                static_cast<size_t>(m->los_verified()));
+  ral::mt_accum(m_data.cum.los_verifications,
+                static_cast<size_t>(m->los_verified()));
 
   ++m_data.interval.robots;
   ++m_data.cum.robots;
@@ -86,6 +90,7 @@ void mdpo_metrics_collector::reset_after_interval(void) {
   m_data.interval.known_percent = 0.0;
   m_data.interval.unknown_percent = 0.0;
   m_data.interval.robots = 0;
+  m_data.interval.los_verifications = 0;
 } /* reset_after_interval() */
 
 NS_END(perception, metrics, fordyca);
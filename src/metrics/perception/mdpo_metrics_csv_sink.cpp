@@ -57,7 +57,9 @@ mdpo_metrics_csv_sink::csv_header_cols(const rmetrics::base_data*) const {
     "int_avg_knowledge_ratio",
     "cum_avg_known_percentage",
     "cum_avg_unknown_percentage",
-    "cum_avg_knowledge_ratio"
+    "cum_avg_knowledge_ratio",
+    "int_avg_los_verifications",
+    "cum_avg_los_verifications"
     /* clang-format on */
   };
   merged.splice(merged.end(), cols);
@@ -90,7 +92,10 @@ mdpo_metrics_csv_sink::csv_line_build(const rmetrics::base_data* data,
   line += csv_entry_tsavg(d->cum.known_percent, t);
   line += csv_entry_tsavg(d->cum.unknown_percent, t);
   line += csv_entry_domavg(
-      d->interval.known_percent, d->interval.unknown_percent, true);
+      d->interval.known_percent, d->interval.unknown_percent);
+
+  line += csv_entry_domavg(d->interval.los_verifications, d->interval.robots);
+  line += csv_entry_domavg(d->cum.los_verifications, d->cum.robots, true);
   return boost::make_optional(line);
 } /* csv_line_build() */
 
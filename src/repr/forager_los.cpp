@@ -23,6 +23,8 @@
  *****************************************************************************/
 #include "fordyca/repr/forager_los.hpp"
 
+#include <unordered_set>
+
 #include "cosm/arena/repr/arena_cache.hpp"
 #include "cosm/ds/cell2D.hpp"
 #include "cosm/repr/sim_block3D.hpp"
@@ -39,13 +41,17 @@ forager_los::forager_los(const rtypes::type_uuid& c_id,
                          const grid_view_type& c_view,
                          const rtypes::discretize_ratio& c_resolution)
     : grid2D_los(c_id, c_view, c_resolution),
-      ER_CLIENT_INIT("fordyca.repr.forager_los") {}
+      ER_CLIENT_INIT("fordyca.repr.forager_los") {
+  objects_extract();
+}
 
 /*******************************************************************************
  * Member Functions
  ******************************************************************************/
-cds::block3D_vectorno forager_los::blocks(void) const {
-  cds::block3D_vectorno blocks{};
+void forager_los::objects_extract(void) {
+  std::unordered_set<const crepr::sim_block3D*> seen_blocks;
+  std::unordered_set<const carepr::base_cache*> seen_caches;
+
   for (size_t i = 0; i < xdsize(); ++i) {
     for (size_t j = 0; j < ydsize(); ++j) {
       const auto& cell = access(i, j);
@@ -54,20 +60,13 @@ cds::block3D_vectorno forager_los::blocks(void) const {
                   "Cell@%s in HAS_BLOCK/BLOCK_EXTENT state, but does not have "
                   "block",
                   rcppsw::to_string(cell.loc()).c_str());
-        blocks.push_back(static_cast<crepr::sim_block3D*>(cell.entity()));
-      }
-    } /* for(j..) */
-  } /* for(i..) */
-  return blocks;
-} /* blocks() */
-
-cads::bcache_vectorno forager_los::caches(void) const {
-  cads::bcache_vectorno caches;
+        auto* block = static_cast<crepr::sim_block3D*>(cell.entity());
 
-  for (size_t i = 0; i < xdsize(); ++i) {
-    for (size_t j = 0; j < ydsize(); ++j) {
-      const auto& cell = access(i, j);
-      if (cell.state_has_cache() || cell.state_in_cache_extent()) {
+        /* blocks which span multiple cells should only be reported once */
+        if (seen_blocks.insert(block).second) {
+          m_blocks.push_back(block);
+        }
+      } else if (cell.state_has_cache() || cell.state_in_cache_extent()) {
         auto* cache = cell.cache();
         ER_ASSERT(nullptr != cache,
                   "Cell@%s in HAS_CACHE/CACHE_EXTENT state, but does not have "
@@ -86,14 +85,12 @@ cads::bcache_vectorno forager_los::caches(void) const {
          * double references to a single cache in a LOS, which can cause
          * problems with pheromone updating. See FORDYCA#433.
          */
-        if (caches.end() == std::find(caches.begin(), caches.end(), cache)) {
-          caches.push_back(cache);
+        if (seen_caches.insert(cache).second) {
+          m_caches.push_back(cache);
         }
       }
     } /* for(j..) */
   } /* for(i..) */
-
-  return caches;
-} /* caches() */
+} /* objects_extract() */
 
 NS_END(repr, fordyca);
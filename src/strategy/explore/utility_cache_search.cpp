@@ -51,16 +51,16 @@ utility_cache_search::utility_cache_search(
  * Member Functions
  ******************************************************************************/
 void utility_cache_search::task_start(cta::taskable_argument*) {
-  auto range = accessor()->known_blocks();
+  auto range = accessor()->known_blocks_range();
   rmath::vector2d position;
-  if (!range.empty()) {
+  if (0 != accessor()->n_known_blocks()) {
     position = std::accumulate(range.begin(),
                                range.end(),
                                rmath::vector2d(),
                                [&](rmath::vector2d& sum, const auto& bent) {
                                  return sum + bent->rcenter2D();
                                }) /
-               range.size();
+               accessor()->n_known_blocks();
   } else {
     position = saa()->sensing()->rpos2D();
   }
@@ -0,0 +1,70 @@
+/**
+ * \file los_verify_parser.cpp
+ *
+ * \copyright 2022 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "fordyca/subsystem/perception/config/los_verify_parser.hpp"
+
+#include "fordyca/subsystem/perception/los_verify_policy.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, subsystem, perception, config);
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+void los_verify_parser::parse(const ticpp::Element& node) {
+  /* LOS verification tag is optional; defaults to always verifying */
+  if (nullptr == node.FirstChild(kXMLRoot, false)) {
+    return;
+  }
+  ER_DEBUG("Parent node=%s: child=%s", node.Value().c_str(), kXMLRoot.c_str());
+
+  ticpp::Element vnode = node_get(node, kXMLRoot);
+  m_config = std::make_unique<config_type>();
+
+  XML_PARSE_ATTR(vnode, m_config, policy);
+  XML_PARSE_ATTR_DFLT(vnode, m_config, interval, 1UL);
+  XML_PARSE_ATTR_DFLT(vnode, m_config, robot_ratio, 1UL);
+} /* parse() */
+
+bool los_verify_parser::validate(void) const {
+  if (!is_parsed()) {
+    return true;
+  }
+  ER_CHECK(los_verify_policy::kALWAYS == m_config->policy ||
+               los_verify_policy::kINTERVAL == m_config->policy ||
+               los_verify_policy::kSAMPLED == m_config->policy ||
+               los_verify_policy::kOFF == m_config->policy,
+           "Bad LOS verification policy '%s'",
+           m_config->policy.c_str());
+  ER_CHECK(m_config->interval > 0, "LOS verification interval must be > 0");
+  ER_CHECK(m_config->robot_ratio > 0,
+           "LOS verification robot ratio must be > 0");
+  return true;
+
+error:
+  return false;
+} /* validate() */
+
+NS_END(config, perception, subsystem, fordyca);
@@ -47,6 +47,9 @@ void mdpo_parser::parse(const ticpp::Element& node) {
   m_config->pheromone =
       *m_pheromone.config_get<cspconfig::xml::pheromone_parser::config_type>();
   m_config->rlos = *m_rlos.config_get<cspconfig::xml::rlos_parser::config_type>();
+
+  XML_PARSE_ATTR_DFLT(mnode, m_config, lazy_decay, false);
+  XML_PARSE_ATTR_DFLT(mnode, m_config, tile_size, 0UL);
 } /* parse() */
 
 bool mdpo_parser::validate(void) const {
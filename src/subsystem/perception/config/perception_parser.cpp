@@ -46,6 +46,7 @@ void perception_parser::parse(const ticpp::Element& node) {
 
   m_dpo.parse(pnode);
   m_mdpo.parse(pnode);
+  m_los_verify.parse(pnode);
 
   if (m_dpo.is_parsed()) {
     m_config->dpo = *m_dpo.config_get<dpo_parser::config_type>();
@@ -53,6 +54,10 @@ void perception_parser::parse(const ticpp::Element& node) {
   if (m_mdpo.is_parsed()) {
     m_config->mdpo = *m_mdpo.config_get<mdpo_parser::config_type>();
   }
+  if (m_los_verify.is_parsed()) {
+    m_config->los_verify =
+        *m_los_verify.config_get<los_verify_parser::config_type>();
+  }
 } /* parse() */
 
 bool perception_parser::validate(void) const {
@@ -61,6 +66,7 @@ bool perception_parser::validate(void) const {
   }
   ER_CHECK(m_dpo.validate(), "DPO validation failed");
   ER_CHECK(m_mdpo.validate(), "MDPO validation failed");
+  ER_CHECK(m_los_verify.validate(), "LOS verification validation failed");
 
   return true;
 
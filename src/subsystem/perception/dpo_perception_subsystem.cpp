@@ -23,6 +23,8 @@
  ******************************************************************************/
 #include "fordyca/subsystem/perception/dpo_perception_subsystem.hpp"
 
+#include <unordered_set>
+
 #include "cosm/arena/repr/arena_cache.hpp"
 #include "cosm/arena/repr/base_cache.hpp"
 #include "cosm/ds/cell2D.hpp"
@@ -42,11 +44,13 @@ NS_START(fordyca, subsystem, perception);
  * Constructors/Destructor
  ******************************************************************************/
 dpo_perception_subsystem::dpo_perception_subsystem(
-    const config::perception_config* const config)
+    const config::perception_config* const config,
+    rmath::rng* rng)
     : ER_CLIENT_INIT("fordyca.subsystem.perception.dpo"),
       foraging_perception_subsystem(
           &config->dpo.rlos,
-          std::make_unique<ds::dpo_store>(&config->dpo.pheromone)) {}
+          std::make_unique<ds::dpo_store>(&config->dpo.pheromone)),
+      m_verify(&config->los_verify, rng) {}
 
 dpo_perception_subsystem::~dpo_perception_subsystem(void) = default;
 
@@ -55,8 +59,10 @@ dpo_perception_subsystem::~dpo_perception_subsystem(void) = default;
  ******************************************************************************/
 void dpo_perception_subsystem::update(oracular_info_receptor* const receptor) {
   process_los(los(), receptor);
-  ER_ASSERT(los_proc_verify(los())(model<ds::dpo_store>()),
-            "LOS verification failed");
+  if (m_verify.verify()) {
+    ER_ASSERT(los_proc_verify(los())(model<ds::dpo_store>()),
+              "LOS verification failed");
+  }
   store()->decay_all();
 } /* update() */
 
@@ -92,7 +98,7 @@ void dpo_perception_subsystem::process_los(
 
 void dpo_perception_subsystem::process_los_caches(
     const repr::forager_los* const c_los) {
-  cads::bcache_vectorno los_caches = c_los->caches();
+  const auto& los_caches = c_los->caches();
   ER_DEBUG("Caches in DPO store: [%s]",
            rcppsw::to_string(store()->known_caches()).c_str());
   if (!los_caches.empty()) {
@@ -122,12 +128,7 @@ void dpo_perception_subsystem::process_los_caches(
 
 void dpo_perception_subsystem::process_los_blocks(
     const repr::forager_los* const c_los) {
-  /*
-   * Because this is computed, rather than a returned reference to a member
-   * variable, we can't use separate begin()/end() calls with it, and need to
-   * explicitly assign it.
-   */
-  auto los_blocks = c_los->blocks();
+  const auto& los_blocks = c_los->blocks();
   ER_DEBUG("Blocks in DPO store: [%s]",
            rcppsw::to_string(store()->known_blocks()).c_str());
   if (!los_blocks.empty()) {
@@ -140,7 +141,7 @@ void dpo_perception_subsystem::process_los_blocks(
    */
   los_tracking_sync(c_los, los_blocks);
 
-  for (auto* block : c_los->blocks()) {
+  for (auto* block : los_blocks) {
     ER_ASSERT(!block->is_out_of_sight(),
               "Block%d@%s/%s out of sight in LOS?",
               block->id().v(),
@@ -170,6 +171,11 @@ void dpo_perception_subsystem::los_tracking_sync(
    * the corresponding cache should also be in our LOS. If it is not, then our
    * tracked version is out of date and needs to be removed.
    */
+  std::unordered_set<rmath::vector2z, ds::dpo_key_hash> los_locs;
+  for (const auto* c : los_caches) {
+    los_locs.insert(c->dcenter2D());
+  } /* for(*c..) */
+
   auto range = store()->known_caches();
   auto it = range.begin();
 
@@ -201,10 +207,7 @@ void dpo_perception_subsystem::los_tracking_sync(
     bool should_be_in_los = (*it)->ydspan().overlaps_with(c_los->ydspan()) &&
                             (*it)->xdspan().overlaps_with(c_los->xdspan());
 
-    bool in_los = los_caches.end() !=
-                  std::find_if(los_caches.begin(),
-                               los_caches.end(),
-                               [&](const auto& c) { return c->dloccmp(**it); });
+    bool in_los = los_locs.end() != los_locs.find((*it)->dcenter2D());
 
     if (should_be_in_los && !in_los) {
       ER_TRACE("Remove tracked DPO cache%d@%s/%s "
@@ -250,92 +253,58 @@ void dpo_perception_subsystem::los_tracking_sync(
    * This logic does NOT handle cases where the tracked block is in our LOS, but
    * has moved since we last saw it (since that is limited to at most a single
    * block, it is handled by the \ref block_found event).
+   *
+   * Rather than checking every tracked block against the LOS, we look up the
+   * block (if any) tracked at each LOS cell, so the cost of this function is
+   * independent of the number of tracked blocks.
    */
-  auto range = store()->known_blocks();
-  auto it = range.begin();
-
-  while (it != range.end()) {
-    ER_TRACE("Examining block%d@%s/%s",
-             (*it)->id().v(),
-             rcppsw::to_string((*it)->ranchor2D()).c_str(),
-             rcppsw::to_string((*it)->danchor2D()).c_str());
-
-    if (!c_los->contains_abs((*it)->danchor2D())) {
-      ++it;
-      continue;
-    }
-    /*
-     * static_cast is safe, because we verified we are only dealing with 2D
-     * blocks earlier in the update chain.
-     */
-    auto exists_in_los =
-        los_blocks.end() !=
-        std::find_if(los_blocks.begin(), los_blocks.end(), [&](const auto& b) {
-          return static_cast<crepr::base_block3D*>(b)->idcmp(*((*it)));
-        });
-    ER_TRACE("Block%d location in LOS", (*it)->id().v());
-    if (!exists_in_los) {
-      ER_INFO("Remove tracked block%d@%s/%s: not in LOS blocks",
-              (*it)->id().v(),
-              rcppsw::to_string((*it)->ranchor2D()).c_str(),
-              rcppsw::to_string((*it)->danchor2D()).c_str());
-      /*
-       * Copy iterator object + iterator increment MUST be before removal to
-       * avoid iterator invalidation and undefined behavior (I've seen both a
-       * segfault and infinite loop). See FORDYCA#589.
-       */
-      crepr::sim_block3D* tmp = *it;
-      ++it;
-      store()->block_remove(tmp);
-    } else {
-      ++it;
-    }
-  } /* while(it..) */
+  std::unordered_set<rtypes::type_uuid, ds::dpo_key_hash> los_ids;
+  for (const auto* b : los_blocks) {
+    los_ids.insert(b->id());
+  } /* for(*b..) */
+
+  for (size_t i = 0; i < c_los->xdsize(); ++i) {
+    for (size_t j = 0; j < c_los->ydsize(); ++j) {
+      const rmath::vector2z& loc = c_los->access(i, j).loc();
+      auto* tracked = store()->tracked_blocks().alt_find(loc);
+      if (nullptr == tracked) {
+        continue;
+      }
+      ER_TRACE("Block%d location in LOS", tracked->ent()->id().v());
+      if (los_ids.end() == los_ids.find(tracked->ent()->id())) {
+        ER_INFO("Remove tracked block%d@%s/%s: not in LOS blocks",
+                tracked->ent()->id().v(),
+                rcppsw::to_string(tracked->ent()->ranchor2D()).c_str(),
+                rcppsw::to_string(tracked->ent()->danchor2D()).c_str());
+        store()->block_remove(tracked->ent());
+      }
+    } /* for(j..) */
+  } /* for(i..) */
 } /* los_tracking_sync() */
 
 /*******************************************************************************
  * DPO Perception Metrics
  ******************************************************************************/
 size_t dpo_perception_subsystem::n_known_blocks(void) const {
-  return store()->known_blocks().size();
+  return store()->n_known_blocks();
 } /* n_known_blocks() */
 
 size_t dpo_perception_subsystem::n_known_caches(void) const {
-  return store()->known_caches().size();
+  return store()->n_known_caches();
 } /* n_known_caches() */
 
 crepr::pheromone_density dpo_perception_subsystem::avg_block_density(void) const {
-  auto range = store()->tracked_blocks().values_range();
-  crepr::pheromone_density ret;
-
-  if (!store()->tracked_blocks().empty()) {
-    ret = std::accumulate(range.begin(),
-                          range.end(),
-                          crepr::pheromone_density(),
-                          [&](const auto& accum, const auto& block) {
-                            return accum + block.density();
-                          }) /
-          store()->tracked_blocks().size();
-  }
-  return ret;
+  return store()->avg_block_density();
 } /* avg_block_density() */
 
 crepr::pheromone_density dpo_perception_subsystem::avg_cache_density(void) const {
-  auto range = store()->tracked_caches().values_range();
-  crepr::pheromone_density ret;
-
-  if (!store()->tracked_caches().empty()) {
-    ret = std::accumulate(range.begin(),
-                          range.end(),
-                          crepr::pheromone_density(),
-                          [&](const auto& accum, const auto& cache) {
-                            return accum + cache.density();
-                          }) /
-          store()->tracked_caches().size();
-  }
-  return ret;
+  return store()->avg_cache_density();
 } /* avg_cache_density() */
 
+bool dpo_perception_subsystem::los_verified(void) const {
+  return m_verify.last_verified();
+} /* los_verified() */
+
 const known_objects_accessor*
 dpo_perception_subsystem::known_objects(void) const {
   return store()->known_objects();
@@ -46,4 +46,8 @@ std::string dp_block_map::to_str(void) const {
                          });
 } /* to_str() */
 
+rmath::vector2z dp_block_map::alt_key(const value_type& v) const {
+  return v.ent()->danchor2D();
+} /* alt_key() */
+
 NS_END(ds, perception, subsystem, fordyca);
@@ -48,4 +48,8 @@ std::string dp_cache_map::to_str(void) const {
                          });
 } /* to_str() */
 
+rtypes::type_uuid dp_cache_map::alt_key(const value_type& v) const {
+  return v.ent()->id();
+} /* alt_key() */
+
 NS_END(ds, perception, subsystem, fordyca);
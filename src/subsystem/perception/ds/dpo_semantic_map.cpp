@@ -70,7 +70,7 @@ model_update_result dpo_semantic_map::block_update(tracked_block_type&& block) {
       op.visit(access<occupancy_grid::kCell>(res.old_loc));
 
       /* reset density in old cell */
-      auto& density = access<occupancy_grid::kPheromone>(res.old_loc);
+      auto& density = pheromone(res.old_loc);
       density.reset();
     }
 
@@ -83,8 +83,7 @@ model_update_result dpo_semantic_map::block_update(tracked_block_type&& block) {
     e.visit(access<occupancy_grid::kCell>(found->ent()->danchor2D()));
 
     /* copy density from DPO store to new cell  */
-    access<occupancy_grid::kPheromone>(found->ent()->danchor2D()) =
-        found->density();
+    pheromone(found->ent()->danchor2D()) = found->density();
   }
   return res;
 } /* block_update() */
@@ -100,8 +99,7 @@ model_update_result dpo_semantic_map::cache_update(tracked_cache_type&& cache) {
     e.visit(access<occupancy_grid::kCell>(found->ent()->dcenter2D()));
 
     /* copy density from DPO store to new cell  */
-    access<occupancy_grid::kPheromone>(found->ent()->dcenter2D()) =
-        found->density();
+    pheromone(found->ent()->dcenter2D()) = found->density();
   }
   return res;
 } /* cache_update() */
@@ -114,13 +112,13 @@ bool dpo_semantic_map::cache_remove(carepr::base_cache* const victim) {
     op.visit(decoratee().access<occupancy_grid::kCell>(victim->dcenter2D()));
 
     /* reset density */
-    decoratee().access<occupancy_grid::kPheromone>(victim->dcenter2D()).reset();
+    decoratee().pheromone(victim->dcenter2D()).reset();
     return true;
   }
   return false;
 } /* cache_remove() */
 
-bool dpo_semantic_map::block_remove(crepr::sim_block3D* const victim) {
+bool dpo_semantic_map::block_remove(const crepr::sim_block3D* const victim) {
   if (m_store.block_remove(victim)) {
     ER_DEBUG("Updating cell@%s for removed block",
              victim->danchor2D().to_str().c_str());
@@ -128,7 +126,7 @@ bool dpo_semantic_map::block_remove(crepr::sim_block3D* const victim) {
     op.visit(access<occupancy_grid::kCell>(victim->danchor2D()));
 
     /* reset density */
-    decoratee().access<occupancy_grid::kPheromone>(victim->danchor2D()).reset();
+    decoratee().pheromone(victim->danchor2D()).reset();
     return true;
   }
   return false;
@@ -140,8 +138,7 @@ void dpo_semantic_map::decay_all(void) {
 
   for (const auto& b : m_store.tracked_blocks().values_range()) {
     const rmath::vector2z& loc = b.ent()->danchor2D();
-    crepr::pheromone_density& map_density =
-        decoratee().access<occupancy_grid::kPheromone>(loc);
+    crepr::pheromone_density& map_density = decoratee().pheromone(loc);
 
     ER_ASSERT(std::fabs((map_density - b.density()).v()) <=
                   std::numeric_limits<double>::epsilon(),
@@ -154,8 +151,7 @@ void dpo_semantic_map::decay_all(void) {
 
   for (auto&& c : m_store.tracked_caches().values_range()) {
     const rmath::vector2z& loc = c.ent()->dcenter2D();
-    crepr::pheromone_density& map_density =
-        decoratee().access<occupancy_grid::kPheromone>(loc);
+    crepr::pheromone_density& map_density = decoratee().pheromone(loc);
 
     ER_ASSERT(std::fabs((map_density - c.density()).v()) <=
                   std::numeric_limits<double>::epsilon(),
@@ -66,39 +66,23 @@ model_update_result dpo_store::cache_update(tracked_cache_type&& cache) {
 } /* cache_update() */
 
 bool dpo_store::cache_remove(carepr::base_cache* const victim) {
-  auto range = tracked_caches().values_range();
-
-  auto it = std::find_if(range.begin(), range.end(), [&](const auto& c) {
-    return c.ent()->idcmp(*victim);
-  });
+  auto* tracked = tracked_caches().alt_find(victim->id());
 
-  if (it != range.end()) {
+  if (nullptr != tracked) {
     ER_TRACE("Removing cache%d@%s",
-             it->ent()->id().v(),
-             it->ent()->dcenter2D().to_str().c_str());
+             tracked->ent()->id().v(),
+             tracked->ent()->dcenter2D().to_str().c_str());
     if (1 == tracked_caches().size()) {
-      last_cache_loc(it->ent()->rcenter2D());
+      last_cache_loc(tracked->ent()->rcenter2D());
     }
-    tracked_caches().obj_remove(it->ent()->dcenter2D());
+    tracked_caches().obj_remove(tracked->ent()->dcenter2D());
     return true;
   }
   return false;
 } /* cache_remove() */
 
 model_update_result dpo_store::block_update(tracked_block_type&& block_in) {
-  auto range = tracked_blocks().values_range();
-
-  auto it1 = std::find_if(range.begin(),
-                          range.end(),
-                          [&block_in](const dpo_entity<crepr::sim_block3D>& b) {
-                            return b.ent()->idcmp(*block_in.ent());
-                          });
-  auto it2 = std::find_if(range.begin(),
-                          range.end(),
-                          [&block_in](const dpo_entity<crepr::sim_block3D>& b) {
-                            return b.ent()->dloccmp(*block_in.ent()) &&
-                                   !b.ent()->idcmp(*block_in.ent());
-                          });
+  auto* by_loc = tracked_blocks().alt_find(block_in.ent()->danchor2D());
 
   /*
    * A different block is currently tracked where the new block was seen, and
@@ -108,15 +92,16 @@ model_update_result dpo_store::block_update(tracked_block_type&& block_in) {
    * list) or not, in order to avoid transient assert() triggering during LOS
    * processing.
    */
-  if (it2 != range.end()) {
+  if (nullptr != by_loc && !by_loc->ent()->idcmp(*block_in.ent())) {
     ER_TRACE("Remove old block%d@%s: new block%d found there",
-             it2->ent()->id().v(),
+             by_loc->ent()->id().v(),
              block_in.ent()->danchor2D().to_str().c_str(),
              block_in.ent()->id().v());
-    block_remove(it2->ent());
+    block_remove(by_loc->ent());
   }
 
-  if (range.end() != it1) { /* block is known */
+  auto* known = tracked_blocks().find(block_in.ent()->id());
+  if (nullptr != known) { /* block is known */
     ER_TRACE("Known incoming block%d@%s",
              block_in.ent()->id().v(),
              block_in.ent()->danchor2D().to_str().c_str());
@@ -124,18 +109,19 @@ model_update_result dpo_store::block_update(tracked_block_type&& block_in) {
      * Unless a given block's location has changed, there is no need to update
      * the state of the world.
      */
-    if (block_in.ent()->danchor2D() != it1->ent()->danchor2D()) {
+    if (block_in.ent()->danchor2D() != known->ent()->danchor2D()) {
       ER_TRACE("Block%d has moved: %s -> %s",
                block_in.ent()->id().v(),
-               it1->ent()->danchor2D().to_str().c_str(),
+               known->ent()->danchor2D().to_str().c_str(),
                block_in.ent()->danchor2D().to_str().c_str());
-      block_remove(it1->ent());
 
       /*
-       * it1 will point to new block after this, so we need to save the old
+       * The known block is destroyed on removal, so we need to save the old
        * location beforehand.
        */
-      rmath::vector2z old_loc = it1->ent()->danchor2D();
+      rmath::vector2z old_loc = known->ent()->danchor2D();
+      block_remove(known->ent());
+
       ER_TRACE("Add block%d@%s (n_blocks=%zu)",
                block_in.ent()->id().v(),
                block_in.ent()->danchor2D().to_str().c_str(),
@@ -148,15 +134,12 @@ model_update_result dpo_store::block_update(tracked_block_type&& block_in) {
      * Even if the block's location has not changed, if we have seen it again we
      * need to update its density.
      */
-    dp_block_map::value_type* known = tracked_blocks().find(block_in.ent()->id());
-    if (nullptr != known) {
-      known->density(block_in.density());
-      ER_TRACE("Update density of known block%d@%s to %f",
-               block_in.ent()->id().v(),
-               block_in.ent()->danchor2D().to_str().c_str(),
-               block_in.density().v());
-      return { model_update_status::ekBLOCK_DENSITY_UPDATE, rmath::vector2z() };
-    }
+    known->density(block_in.density());
+    ER_TRACE("Update density of known block%d@%s to %f",
+             block_in.ent()->id().v(),
+             block_in.ent()->danchor2D().to_str().c_str(),
+             block_in.density().v());
+    return { model_update_status::ekBLOCK_DENSITY_UPDATE, rmath::vector2z() };
   } else { /* block is not known */
     ER_TRACE("Unknown incoming block%d", block_in.ent()->id().v());
     ER_TRACE("Add block%d@%s (n_blocks=%zu)",
@@ -166,22 +149,18 @@ model_update_result dpo_store::block_update(tracked_block_type&& block_in) {
     tracked_blocks().obj_add({ block_in.ent()->id(), std::move(block_in) });
     return { model_update_status::ekNEW_BLOCK_ADDED, rmath::vector2z() };
   }
-  return { model_update_status::ekNO_CHANGE, rmath::vector2z() };
 } /* block_update() */
 
-bool dpo_store::block_remove(crepr::sim_block3D* const victim) {
-  auto range = tracked_blocks().values_range();
-  auto it = std::find_if(range.begin(), range.end(), [&](const auto& b) {
-    return b.ent()->idcmp(*victim);
-  });
-  if (it != range.end()) {
+bool dpo_store::block_remove(const crepr::sim_block3D* const victim) {
+  auto* tracked = tracked_blocks().find(victim->id());
+  if (nullptr != tracked) {
     ER_TRACE("Removing block%d@%s",
              victim->id().v(),
              victim->danchor2D().to_str().c_str());
     if (1 == tracked_blocks().size()) {
-      last_block_loc(it->ent()->ranchor2D());
+      last_block_loc(tracked->ent()->ranchor2D());
     }
-    tracked_blocks().obj_remove(it->ent()->id());
+    tracked_blocks().obj_remove(victim->id());
     return true;
   }
   return false;
@@ -192,6 +171,38 @@ void dpo_store::decay_all(void) {
   tracked_caches().decay_all();
 } /* decay_all() */
 
+crepr::pheromone_density dpo_store::avg_block_density(void) const {
+  auto range = tracked_blocks().values_range();
+  crepr::pheromone_density ret;
+
+  if (!tracked_blocks().empty()) {
+    ret = std::accumulate(range.begin(),
+                          range.end(),
+                          crepr::pheromone_density(),
+                          [&](const auto& accum, const auto& block) {
+                            return accum + block.density();
+                          }) /
+          tracked_blocks().size();
+  }
+  return ret;
+} /* avg_block_density() */
+
+crepr::pheromone_density dpo_store::avg_cache_density(void) const {
+  auto range = tracked_caches().values_range();
+  crepr::pheromone_density ret;
+
+  if (!tracked_caches().empty()) {
+    ret = std::accumulate(range.begin(),
+                          range.end(),
+                          crepr::pheromone_density(),
+                          [&](const auto& accum, const auto& cache) {
+                            return accum + cache.density();
+                          }) /
+          tracked_caches().size();
+  }
+  return ret;
+} /* avg_cache_density() */
+
 void dpo_store::clear_all(void) {
   tracked_blocks().clear();
   tracked_caches().clear();
@@ -23,6 +23,9 @@
  ******************************************************************************/
 #include "fordyca/subsystem/perception/ds/occupancy_grid.hpp"
 
+#include <algorithm>
+#include <cmath>
+
 #include "fordyca/events/cell2D_unknown.hpp"
 
 /*******************************************************************************
@@ -35,64 +38,332 @@ NS_START(fordyca, subsystem, perception, ds);
  ******************************************************************************/
 occupancy_grid::occupancy_grid(const config::mdpo_config* c_config)
     : ER_CLIENT_INIT("fordyca.subsystem.perception.ds.occupancy_grid"),
-      stacked_grid2D(rmath::vector2d(0.0, 0.0),
-                     c_config->rlos.grid2D.dims,
-                     c_config->rlos.grid2D.resolution,
-                     c_config->rlos.grid2D.resolution),
-      m_pheromone_repeat_deposit(c_config->pheromone.repeat_deposit) {
-  ER_INFO("real=(%fx%f), discrete=(%zux%zu), resolution=%f",
+      m_pheromone_repeat_deposit(c_config->pheromone.repeat_deposit),
+      mc_pheromone_rho(c_config->pheromone.rho),
+      mc_lazy_decay(c_config->lazy_decay),
+      mc_tiled(c_config->tile_size > 0),
+      mc_resolution(c_config->rlos.grid2D.resolution),
+      m_xdsize(static_cast<size_t>(
+          std::ceil(c_config->rlos.grid2D.dims.x() / mc_resolution.v()))),
+      m_ydsize(static_cast<size_t>(
+          std::ceil(c_config->rlos.grid2D.dims.y() / mc_resolution.v()))),
+      m_tile_xdim(mc_tiled ? c_config->tile_size : m_xdsize),
+      m_tile_ydim(mc_tiled ? c_config->tile_size : m_ydsize),
+      m_n_ytiles((m_ydsize + m_tile_ydim - 1) / m_tile_ydim) {
+  size_t n_xtiles = (m_xdsize + m_tile_xdim - 1) / m_tile_xdim;
+  m_tiles.resize(n_xtiles * m_n_ytiles);
+
+  ER_INFO("real=(%fx%f), discrete=(%zux%zu), resolution=%f, lazy_decay=%d, "
+          "tiles=(%zux%zu)@(%zux%zu)",
           xrsize(),
           yrsize(),
           xdsize(),
           ydsize(),
-          resolution().v());
+          resolution().v(),
+          mc_lazy_decay,
+          n_xtiles,
+          m_n_ytiles,
+          m_tile_xdim,
+          m_tile_ydim);
 
-  for (size_t i = 0; i < xdsize(); ++i) {
-    for (size_t j = 0; j < ydsize(); ++j) {
-      cell_init(i, j, c_config->pheromone.rho);
-    } /* for(j..) */
-  } /* for(i..) */
+  /* without tiling, the whole grid is allocated up front */
+  if (!mc_tiled) {
+    tile_get(0, 0);
+  }
 }
 
 /*******************************************************************************
  * Member Functions
  ******************************************************************************/
 void occupancy_grid::update(void) {
-  size_t xmax = xdsize();
-  size_t ymax = ydsize();
+  tiles_idle_update();
 
-  for (size_t i = 0; i < xmax; ++i) {
-    for (size_t j = 0; j < ymax; ++j) {
-      access<kPheromone>(i, j).update();
-    } /* for(j..) */
-  } /* for(i..) */
+  if (mc_lazy_decay) {
+    /*
+     * Schedule all cells touched since the last update for expiry based on
+     * their current density, then visit only the cells which expire this
+     * timestep. Cells which have been touched again since they were scheduled
+     * will have a different expiry, and their stale queue entries are ignored,
+     * as are entries for cells in tiles which have since been freed.
+     */
+    for (auto& loc : m_lazy_dirty) {
+      lazy_expiry_schedule(loc.x(), loc.y());
+    } /* for(&loc..) */
+    m_lazy_dirty.clear();
 
-  for (size_t i = 0; i < xmax; ++i) {
-    for (size_t j = 0; j < ymax; ++j) {
+    ++m_tick;
+    while (!m_lazy_expiry.empty() &&
+           std::get<0>(m_lazy_expiry.top()) <= m_tick) {
+      auto [expiry, i, j] = m_lazy_expiry.top();
+      m_lazy_expiry.pop();
+      auto* t = tile_find(i, j);
+      if (nullptr == t || t->lazy[cell_index(i, j)].expiry != expiry) {
+        continue;
+      }
+      lazy_expiry_set(t, i, j, kNEVER);
       cell_state_update(i, j);
-    } /* for(j..) */
-  } /* for(i..) */
+
+      /* guard against rounding in the closed form expiry computation */
+      lazy_expiry_schedule(i, j);
+
+      if (0 == t->n_scheduled) {
+        tile_release_check(i, j);
+      }
+    } /* while(!m_lazy_expiry.empty()..) */
+    return;
+  }
+
+  /*
+   * Decay all live cells, collecting the ones which need their state updated
+   * as we go, so that the cell layer is only touched for cells which are
+   * actually expiring.
+   */
+  m_expired.clear();
+  for (size_t k = 0; k < m_tiles.size(); ++k) {
+    if (nullptr != m_tiles[k]) {
+      tile_decay(m_tiles[k].get(),
+                 (k / m_n_ytiles) * m_tile_xdim,
+                 (k % m_n_ytiles) * m_tile_ydim);
+    }
+  } /* for(k..) */
+
+  for (auto& loc : m_expired) {
+    cell_state_update(loc.x(), loc.y());
+    auto* t = tile_find(loc.x(), loc.y());
+    if (layer_access<kPheromone>(t, loc.x(), loc.y()).v() <=
+        std::numeric_limits<double>::min()) {
+      live_clear(t, loc.x(), loc.y());
+      if (std::all_of(t->live.begin(), t->live.end(), [](uint64_t word) {
+            return 0 == word;
+          })) {
+        tile_release_check(loc.x(), loc.y());
+      }
+    }
+  } /* for(&loc..) */
 } /* update() */
 
+void occupancy_grid::tile_decay(tile* t, size_t xoffset, size_t yoffset) {
+  for (size_t w = 0; w < t->live.size(); ++w) {
+    if (0 == t->live[w]) {
+      continue;
+    }
+    for (size_t b = 0; b < kLIVE_WORD_BITS; ++b) {
+      if (0 == (t->live[w] & (uint64_t{1} << b))) {
+        continue;
+      }
+      size_t index = w * kLIVE_WORD_BITS + b;
+      size_t i = xoffset + index / m_tile_ydim;
+      size_t j = yoffset + index % m_tile_ydim;
+      crepr::pheromone_density& density = t->pheromone[index];
+      density.update();
+      if (density.v() < kEPSILON) {
+        m_expired.push_back(rmath::vector2z(i, j));
+      } else if (!m_pheromone_repeat_deposit) {
+        ER_ASSERT(density.v() <= 1.0,
+                  "Repeat pheromone deposit detected for cell@(%zu, %zu) (%f "
+                  "> 1.0)",
+                  i,
+                  j,
+                  density.v());
+      }
+    } /* for(b..) */
+  } /* for(w..) */
+} /* tile_decay() */
+
 void occupancy_grid::reset(void) {
-  size_t xmax = xdsize();
-  size_t ymax = ydsize();
-  for (size_t i = 0; i < xmax; ++i) {
-    for (size_t j = 0; j < ymax; ++j) {
-      access<kCell>(i, j).reset();
-    } /* for(j..) */
-  } /* for(i..) */
-} /* Reset */
-
-void occupancy_grid::cell_init(size_t i, size_t j, double pheromone_rho) {
-  access<kPheromone>(i, j).rho(pheromone_rho);
-  cds::cell2D& cell = access<kCell>(i, j);
-  cell.loc(rmath::vector2z(i, j));
-} /* cell_init() */
+  /*
+   * Drop all tiles rather than resetting their cells, so that densities and
+   * the lazy/live bookkeeping are reset along with the cells.
+   */
+  for (auto& t : m_tiles) {
+    t.reset();
+  } /* for(&t..) */
+  m_expired.clear();
+  m_tick = 0;
+  m_lazy_dirty.clear();
+  m_lazy_expiry = expiry_queue();
+  m_known_cell_count = 0;
+
+  if (!mc_tiled) {
+    tile_get(0, 0);
+  }
+} /* reset() */
+
+occupancy_grid::tile* occupancy_grid::tile_get(size_t i, size_t j) const {
+  auto& t = m_tiles[tile_index(i, j)];
+  if (nullptr != t) {
+    return t.get();
+  }
+  size_t n_cells = m_tile_xdim * m_tile_ydim;
+  t = std::make_unique<tile>();
+  t->pheromone.resize(n_cells);
+  t->cells.resize(n_cells);
+  if (mc_lazy_decay) {
+    t->lazy.resize(n_cells);
+  } else {
+    t->live.resize((n_cells + kLIVE_WORD_BITS - 1) / kLIVE_WORD_BITS);
+  }
+
+  /*
+   * Needed because the cells do not support non zero parameter constructors,
+   * and we do *NOT* want to use pointers to cells, because that kills our
+   * memory performance.
+   */
+  size_t xoffset = (i / m_tile_xdim) * m_tile_xdim;
+  size_t yoffset = (j / m_tile_ydim) * m_tile_ydim;
+  for (size_t k = 0; k < n_cells; ++k) {
+    t->pheromone[k].rho(mc_pheromone_rho);
+    t->cells[k].loc(rmath::vector2z(xoffset + k / m_tile_ydim,
+                                    yoffset + k % m_tile_ydim));
+  } /* for(k..) */
+  return t.get();
+} /* tile_get() */
+
+void occupancy_grid::tile_release_check(size_t i, size_t j) {
+  if (!mc_tiled) {
+    return;
+  }
+  auto& t = m_tiles[tile_index(i, j)];
+  if (t->idle < kTILE_IDLE_UPDATES) {
+    return;
+  }
+  size_t n_empty = 0;
+  for (size_t k = 0; k < t->cells.size(); ++k) {
+    if (t->pheromone[k].v() > std::numeric_limits<double>::min()) {
+      return;
+    }
+    if (t->cells[k].state_is_empty()) {
+      ++n_empty;
+    } else if (t->cells[k].state_is_known()) {
+      return;
+    }
+  } /* for(k..) */
+
+  /* EMPTY cells in the tile revert to UNKNOWN */
+  ER_TRACE("Free tile containing cell(%zu, %zu): %zu empty cells",
+           i,
+           j,
+           n_empty);
+  m_known_cell_count -= n_empty;
+  t.reset();
+} /* tile_release_check() */
+
+void occupancy_grid::tiles_idle_update(void) {
+  if (!mc_tiled) {
+    return;
+  }
+  for (size_t k = 0; k < m_tiles.size(); ++k) {
+    auto& t = m_tiles[k];
+    if (nullptr == t || t->idle >= kTILE_IDLE_UPDATES) {
+      continue;
+    }
+    if (kTILE_IDLE_UPDATES == ++t->idle) {
+      tile_release_check((k / m_n_ytiles) * m_tile_xdim,
+                         (k % m_n_ytiles) * m_tile_ydim);
+    }
+  } /* for(k..) */
+} /* tiles_idle_update() */
+
+crepr::pheromone_density& occupancy_grid::pheromone(size_t i, size_t j) {
+  auto* t = tile_get(i, j);
+  t->idle = 0;
+  if (!mc_lazy_decay) {
+    /* the caller may give the cell a non-zero density */
+    live_mark(t, i, j);
+    return layer_access<kPheromone>(t, i, j);
+  }
+  auto& info = t->lazy[cell_index(i, j)];
+
+  /*
+   * The caller may modify the density, so the cell needs to have its expiry
+   * recomputed at the next update; only add it to the dirty list once per
+   * timestep.
+   */
+  if (info.touched != m_tick) {
+    m_lazy_dirty.push_back(rmath::vector2z(i, j));
+  }
+  return lazy_materialize(i, j);
+} /* pheromone() */
+
+crepr::pheromone_density& occupancy_grid::lazy_materialize(size_t i,
+                                                           size_t j) {
+  auto* t = tile_get(i, j);
+  auto& info = t->lazy[cell_index(i, j)];
+  crepr::pheromone_density& density = layer_access<kPheromone>(t, i, j);
+
+  if (kNEVER != info.touched && info.touched != m_tick) {
+    size_t dt = m_tick - info.touched;
+
+    /*
+     * A single step of decay goes through the same path as eager decay so that
+     * densities of cells touched every timestep (i.e., cells containing
+     * tracked objects) stay bit-for-bit identical to their DPO store
+     * counterparts.
+     */
+    if (1 == dt) {
+      density.update();
+    } else {
+      density.pheromone_set(density.v() *
+                            std::pow(1.0 - mc_pheromone_rho, dt));
+    }
+  }
+  info.touched = m_tick;
+  return density;
+} /* lazy_materialize() */
+
+void occupancy_grid::lazy_expiry_schedule(size_t i, size_t j) {
+  auto* t = tile_get(i, j);
+  crepr::pheromone_density& density = lazy_materialize(i, j);
+
+  if (!m_pheromone_repeat_deposit) {
+    ER_ASSERT(density.v() <= 1.0,
+              "Repeat pheromone deposit detected for cell@(%zu, %zu) (%f > "
+              "1.0, state=%d)",
+              i,
+              j,
+              density.v(),
+              layer_access<kCell>(t, i, j).fsm().current_state());
+  }
+
+  /* cells with no density never expire, same as for eager decay */
+  if (density.v() <= std::numeric_limits<double>::min() ||
+      mc_pheromone_rho <= 0.0) {
+    lazy_expiry_set(t, i, j, kNEVER);
+    return;
+  }
+  /*
+   * Smallest n >= 1 such that v * (1 - rho)^n < kEPSILON, which is the
+   * timestep eager decay would reset the cell on.
+   */
+  size_t n = 1;
+  if (density.v() >= kEPSILON && mc_pheromone_rho < 1.0) {
+    double ratio =
+        std::log(kEPSILON / density.v()) / std::log(1.0 - mc_pheromone_rho);
+    n = static_cast<size_t>(std::floor(ratio)) + 1;
+  }
+  lazy_expiry_set(t, i, j, m_tick + n);
+  m_lazy_expiry.emplace(m_tick + n, i, j);
+} /* lazy_expiry_schedule() */
+
+void occupancy_grid::lazy_expiry_set(tile* t,
+                                     size_t i,
+                                     size_t j,
+                                     size_t expiry) {
+  auto& info = t->lazy[cell_index(i, j)];
+  if (kNEVER == info.expiry && kNEVER != expiry) {
+    ++t->n_scheduled;
+  } else if (kNEVER != info.expiry && kNEVER == expiry) {
+    --t->n_scheduled;
+  }
+  info.expiry = expiry;
+} /* lazy_expiry_set() */
 
 void occupancy_grid::cell_state_update(size_t i, size_t j) {
-  crepr::pheromone_density& density = access<kPheromone>(i, j);
-  cds::cell2D& cell = access<kCell>(i, j);
+  auto* t = tile_get(i, j);
+  crepr::pheromone_density& density = mc_lazy_decay
+                                          ? lazy_materialize(i, j)
+                                          : layer_access<kPheromone>(t, i, j);
+  cds::cell2D& cell = layer_access<kCell>(t, i, j);
 
   if (!m_pheromone_repeat_deposit) {
     ER_ASSERT(density.v() <= 1.0,
@@ -28,6 +28,7 @@
 #include "cosm/repr/pheromone_density.hpp"
 #include "cosm/repr/sim_block3D.hpp"
 
+#include "fordyca/repr/dpo_snapshot_pool.hpp"
 #include "fordyca/subsystem/perception/dpo_perception_subsystem.hpp"
 #include "fordyca/subsystem/perception/ds/dpo_semantic_map.hpp"
 #include "fordyca/subsystem/perception/mdpo_perception_subsystem.hpp"
@@ -40,7 +41,7 @@ NS_START(fordyca, subsystem, perception, events);
 /*******************************************************************************
  * Constructors/Destructor
  ******************************************************************************/
-block_found::block_found(crepr::sim_block3D* block)
+block_found::block_found(const crepr::sim_block3D* block)
     : ER_CLIENT_INIT("fordyca.subsystem.perception.events.block_found"),
       cell2D_op(block->danchor2D()),
       m_block(block) {}
@@ -49,7 +50,11 @@ block_found::block_found(crepr::sim_block3D* block)
  * FSMs
  ******************************************************************************/
 void block_found::visit(cds::cell2D& cell) {
-  cell.entity(m_block);
+  /*
+   * The block may be a snapshot shared with other robots; cells only refer to
+   * their entity and never modify it.
+   */
+  cell.entity(const_cast<crepr::sim_block3D*>(m_block));
   this->visit(cell.fsm());
 } /* visit() */
 
@@ -87,6 +92,7 @@ fsperception::model_update_result block_found::visit(fspds::dpo_store& store) {
 
   crepr::pheromone_density density(store.pheromone_rho());
   auto* known = store.find(m_block);
+  std::shared_ptr<const crepr::sim_block3D> snapshot;
   if (nullptr != known) {
     /*
      * If the block we just "found" is already known and has a different
@@ -103,6 +109,9 @@ fsperception::model_update_result block_found::visit(fspds::dpo_store& store) {
     } else { /* block has not moved */
       density = known->density();
 
+      /* our tracked version is still accurate--no need for a new snapshot */
+      snapshot = known->snapshot();
+
       /*
        * If repeat pheromone deposits are enabled, make a deposit. Otherwise,
        * just reset the pheromone density to make because we have seen the block
@@ -118,11 +127,16 @@ fsperception::model_update_result block_found::visit(fspds::dpo_store& store) {
     density.pheromone_set(fspds::dpo_store::kNRD_MAX_PHEROMONE);
   }
 
-  auto* raw = m_block->clone().release();
-  auto clone = std::unique_ptr<crepr::sim_block3D>();
-  clone.reset(static_cast<crepr::sim_block3D*>(raw));
+  /*
+   * Share a snapshot of the block with all other robots which have seen it at
+   * its current location, rather than cloning it.
+   */
+  if (nullptr == snapshot) {
+    snapshot = block_snapshot_pool::instance().acquire(m_block,
+                                                       m_block->ranchor2D());
+  }
   return store.block_update(
-      repr::dpo_entity<crepr::sim_block3D>(std::move(clone), density));
+      repr::dpo_entity<const crepr::sim_block3D>(std::move(snapshot), density));
 } /* visit() */
 
 void block_found::visit(fspds::dpo_semantic_map& map) {
@@ -48,16 +48,19 @@ bool los_proc_verify::operator()(const ds::dpo_store* const c_dpo) const {
    * here. The fix is to only assert() if there is not a cache that contains the
    * block's location, and it is therefore not occluded.
    */
-  for (const auto& cache : c_dpo->known_caches()) {
-    for (auto* block : mc_los->blocks()) {
-      if (!cache->contains_point(block->ranchor2D())) {
-        ER_ASSERT(c_dpo->contains(block),
-                  "Store does not contain block%d@%s",
-                  block->id().v(),
-                  block->danchor2D().to_str().c_str());
-      }
-    } /* for(&block..) */
-  } /* for(&cache..) */
+  bool no_caches = 0 == c_dpo->n_known_caches();
+  for (auto* block : mc_los->blocks()) {
+    /* common case: nothing to check */
+    if (no_caches || c_dpo->contains(block)) {
+      continue;
+    }
+    for (const auto* cache : c_dpo->known_caches_range()) {
+      ER_ASSERT(cache->contains_point(block->ranchor2D()),
+                "Store does not contain block%d@%s",
+                block->id().v(),
+                block->danchor2D().to_str().c_str());
+    } /* for(&cache..) */
+  } /* for(*block..) */
 
   /*
    * Verify that for each cell that contained a cache in the LOS:
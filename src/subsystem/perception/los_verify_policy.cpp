@@ -0,0 +1,71 @@
+/**
+ * \file los_verify_policy.cpp
+ *
+ * \copyright 2022 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "fordyca/subsystem/perception/los_verify_policy.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, subsystem, perception);
+
+/*******************************************************************************
+ * Constructors/Destructor
+ ******************************************************************************/
+los_verify_policy::los_verify_policy(const config::los_verify_config* config,
+                                     rmath::rng* rng)
+    : ER_CLIENT_INIT("fordyca.subsystem.perception.los_verify_policy"),
+      mc_config(*config) {
+  if (kSAMPLED == mc_config.policy) {
+    /*
+     * Draw from the robot's RNG, which is seeded from the experiment seed, so
+     * that which robots are selected only depends on the experiment, and not
+     * on what else this process has done before.
+     */
+    auto ratio = static_cast<int>(mc_config.robot_ratio);
+    m_selected = (0 == rng->uniform(0, ratio - 1));
+  }
+  ER_INFO("LOS verification policy=%s,interval=%zu,robot_ratio=%zu,selected=%d",
+          mc_config.policy.c_str(),
+          mc_config.interval,
+          mc_config.robot_ratio,
+          m_selected);
+}
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+bool los_verify_policy::verify(void) {
+  if (kALWAYS == mc_config.policy) {
+    m_last_verified = true;
+  } else if (kINTERVAL == mc_config.policy) {
+    m_last_verified = (0 == m_step % mc_config.interval);
+  } else if (kSAMPLED == mc_config.policy) {
+    m_last_verified = m_selected;
+  } else {
+    m_last_verified = false;
+  }
+  ++m_step;
+  return m_last_verified;
+} /* verify() */
+
+NS_END(perception, subsystem, fordyca);
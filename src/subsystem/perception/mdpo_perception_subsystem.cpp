@@ -47,13 +47,15 @@ using ds::occupancy_grid;
  * Constructors/Destructor
  ******************************************************************************/
 mdpo_perception_subsystem::mdpo_perception_subsystem(
-    const config::perception_config* const config)
+    const config::perception_config* const config,
+    rmath::rng* rng)
     : ER_CLIENT_INIT("fordyca.subsystem.perception.mdpo"),
       foraging_perception_subsystem(
           &config->mdpo.rlos,
           std::make_unique<ds::dpo_semantic_map>(&config->mdpo)),
       m_cell_stats(cfsm::cell2D_state::ekST_MAX_STATES),
-      m_los() {}
+      m_los(),
+      m_verify(&config->los_verify, rng) {}
 
 mdpo_perception_subsystem::~mdpo_perception_subsystem(void) = default;
 
@@ -63,7 +65,9 @@ mdpo_perception_subsystem::~mdpo_perception_subsystem(void) = default;
 void mdpo_perception_subsystem::update(oracular_info_receptor* const receptor) {
   update_cell_stats(los());
   process_los(los(), receptor);
-  ER_ASSERT(los_proc_verify(los())(map()), "LOS verification failed");
+  if (m_verify.verify()) {
+    ER_ASSERT(los_proc_verify(los())(map()), "LOS verification failed");
+  }
   map()->decay_all();
 } /* update() */
 
@@ -99,12 +103,7 @@ void mdpo_perception_subsystem::process_los(
 
 void mdpo_perception_subsystem::process_los_blocks(
     const repr::forager_los* const c_los) {
-  /*
-   * Because this is computed, rather than a returned reference to a member
-   * variable, we can't use separate begin()/end() calls with it, and need to
-   * explicitly assign it.
-   */
-  auto blocks = c_los->blocks();
+  const auto& blocks = c_los->blocks();
   if (!blocks.empty()) {
     auto accum =
         std::accumulate(blocks.begin(),
@@ -151,7 +150,7 @@ void mdpo_perception_subsystem::process_los_blocks(
     } /* for(j..) */
   } /* for(i..) */
 
-  for (auto* block : c_los->blocks()) {
+  for (auto* block : blocks) {
     ER_ASSERT(!block->is_out_of_sight(),
               "Block%d out of sight in LOS?",
               block->id().v());
@@ -166,11 +165,10 @@ void mdpo_perception_subsystem::process_los_blocks(
                block->id().v(),
                block->ranchor2D().to_str().c_str(),
                block->danchor2D().to_str().c_str());
-      auto range = map()->known_blocks();
-      auto it = std::find_if(range.begin(), range.end(), [&](const auto& b1) {
-        return b1->id() == cell.block3D()->id();
-      });
-      ER_ASSERT(it != range.end(), "Known block%d not in PAM", block->id().v());
+      ER_ASSERT(nullptr != map()->store()->tracked_blocks().find(
+                               cell.block3D()->id()),
+                "Known block%d not in PAM",
+                block->id().v());
     }
     events::block_found_visitor op(block);
     op.visit(*map());
@@ -179,12 +177,7 @@ void mdpo_perception_subsystem::process_los_blocks(
 
 void mdpo_perception_subsystem::process_los_caches(
     const repr::forager_los* const c_los) {
-  /*
-   * Because this is computed, rather than a returned reference to a member
-   * variable, we can't use separate begin()/end() calls with it, and need to
-   * explicitly assign it.
-   */
-  auto los_caches = c_los->caches();
+  const auto& los_caches = c_los->caches();
   if (!los_caches.empty()) {
     ER_DEBUG("Caches in LOS: [%s]", rcppsw::to_string(los_caches).c_str());
     ER_DEBUG("Caches in DPO store: [%s]",
@@ -292,6 +285,10 @@ double mdpo_perception_subsystem::unknown_percentage(void) const {
   return 1.0 - known_percentage();
 } /* unknown_percentage() */
 
+bool mdpo_perception_subsystem::los_verified(void) const {
+  return m_verify.last_verified();
+} /* los_verified() */
+
 void mdpo_perception_subsystem::reset_metrics(void) {
   m_cell_stats.assign(m_cell_stats.size(), 0);
 } /* reset_metrics() */